@@ -26,42 +26,16 @@
     Only keep track of sum of card values, not the specific cards dealt.
 */
 
+#include "../cppCommon/Cards.h"
 #include <iostream>
 #include <array>
 #include <algorithm>
 #include <random>
-#include <cassert>
 #include <vector>
 #include <ctime>
 
-enum class Suit
-{
-    Clubs,
-    Diamonds,
-    Hearts,
-    Spades,
-
-    n_suits,
-};
-
-enum class Rank
-{
-    rank_2,
-    rank_3,
-    rank_4,
-    rank_5,
-    rank_6,
-    rank_7,
-    rank_8,
-    rank_9,
-    rank_10,
-    rank_J,
-    rank_Q,
-    rank_K,
-    rank_A,
-
-    n_ranks,
-};
+using Cards::Suit;
+using Cards::Rank;
 
 struct Card
 {
@@ -71,36 +45,10 @@ struct Card
 
 void printCard(const Card& card)
 {
-    switch(card.rank)
-    {
-        case Rank::rank_2:      std::cout << '2'; break;
-        case Rank::rank_3:      std::cout << '3'; break;
-        case Rank::rank_4:      std::cout << '4'; break;
-        case Rank::rank_5:      std::cout << '5'; break;
-        case Rank::rank_6:      std::cout << '6'; break;
-        case Rank::rank_7:      std::cout << '7'; break;
-        case Rank::rank_8:      std::cout << '8'; break;
-        case Rank::rank_9:      std::cout << '9'; break;
-        case Rank::rank_10:     std::cout << "10"; break;
-        case Rank::rank_J:      std::cout << 'J'; break;
-        case Rank::rank_Q:      std::cout << 'Q'; break;
-        case Rank::rank_K:      std::cout << 'K'; break;
-        case Rank::rank_A:      std::cout << 'A'; break;
-
-        default:                std::cout << '?'; break;
-    }   
-    switch(card.suit)
-    {
-        case Suit::Clubs:       std::cout << 'C'; break;
-        case Suit::Diamonds:    std::cout << 'D'; break;
-        case Suit::Hearts:      std::cout << 'H'; break;
-        case Suit::Spades:      std::cout << 'S'; break;
-
-        default:                std::cout << '?'; break;
-    }   
+    std::cout << Cards::name(card.rank) << Cards::name(card.suit);
 }
 
-using Deck = std::array<Card, 52>;
+using Deck = std::array<Card, Cards::n_cards>;
 using Index = Deck::size_type;
 Deck createDeck()
 {
@@ -141,26 +89,7 @@ void shuffleDeck(Deck& deck)
 
 int getCardValue(Card& card)
 {
-    switch(card.rank)
-    {
-        case Rank::rank_2:      return 2; 
-        case Rank::rank_3:      return 3; 
-        case Rank::rank_4:      return 4; 
-        case Rank::rank_5:      return 5; 
-        case Rank::rank_6:      return 6; 
-        case Rank::rank_7:      return 7; 
-        case Rank::rank_8:      return 8; 
-        case Rank::rank_9:      return 9; 
-        case Rank::rank_10:     return 10;
-        case Rank::rank_J:      return 10; 
-        case Rank::rank_Q:      return 10; 
-        case Rank::rank_K:      return 10; 
-        case Rank::rank_A:      return 11; 
-
-        default:
-            assert(false && "Card rank not in enum class Rank");
-            return 0;
-    }   
+    return Cards::value(card.rank);
 }
 
 bool hitOrStand()
@@ -0,0 +1,219 @@
+/*  Header file containing the shared playing card definitions
+ *
+ *  Suit and Rank for a 52-card deck, with constexpr tables for card values
+ *  and names in place of per-card switch statements.
+ *
+ *  A card's index is rank * 4 + suit (0-51), which fits in one byte. The
+ *  same index is the card's bit in a CardSet, a 64-bit mask holding any set
+ *  of cards from one deck: the four cards of a rank sit in one nibble, so
+ *  hand values come from a few table lookups and popcounts.
+ */
+
+#ifndef CARDS_H
+#define CARDS_H
+
+#include <cassert>
+#include <cstdint>
+#include <string_view>
+
+namespace Cards
+{
+    enum class Suit
+    {
+        Clubs,
+        Diamonds,
+        Hearts,
+        Spades,
+
+        n_suits,
+    };
+
+    enum class Rank
+    {
+        rank_2,
+        rank_3,
+        rank_4,
+        rank_5,
+        rank_6,
+        rank_7,
+        rank_8,
+        rank_9,
+        rank_10,
+        rank_J,
+        rank_Q,
+        rank_K,
+        rank_A,
+
+        n_ranks,
+    };
+
+    constexpr int n_suits{ static_cast<int>(Suit::n_suits) };
+    constexpr int n_ranks{ static_cast<int>(Rank::n_ranks) };
+    constexpr int n_cards{ n_suits * n_ranks };
+
+    constexpr int blackjack{ 21 };
+
+    // Indexed by Rank
+    constexpr int rank_values[n_ranks]{ 2, 3, 4, 5, 6, 7, 8, 9, 10, 10, 10, 10, 11 };
+    constexpr std::string_view rank_names[n_ranks]{ "2", "3", "4", "5", "6", "7", "8", "9", "10",
+                                                    "J", "Q", "K", "A" };
+    // Indexed by Suit
+    constexpr char suit_names[n_suits]{ 'C', 'D', 'H', 'S' };
+
+    // Blackjack value with an ace counted as 11
+    constexpr int value(Rank rank)
+    {
+        assert(rank >= Rank::rank_2 && rank < Rank::n_ranks && "Card rank not in enum class Rank");
+        return rank_values[static_cast<int>(rank)];
+    }
+
+    constexpr std::string_view name(Rank rank)
+    {
+        return (rank >= Rank::rank_2 && rank < Rank::n_ranks) ? rank_names[static_cast<int>(rank)] : "?";
+    }
+
+    constexpr char name(Suit suit)
+    {
+        return (suit >= Suit::Clubs && suit < Suit::n_suits) ? suit_names[static_cast<int>(suit)] : '?';
+    }
+
+    constexpr int index(Rank rank, Suit suit)
+    {
+        return static_cast<int>(rank) * n_suits + static_cast<int>(suit);
+    }
+
+    constexpr Rank rankOf(int index) { return static_cast<Rank>(index / n_suits); }
+    constexpr Suit suitOf(int index) { return static_cast<Suit>(index % n_suits); }
+
+    // Total of a hand, with one ace counted as 11 if that does not bust it
+    // (a "soft" total)
+    struct HandValue
+    {
+        int total{ 0 };
+        bool soft{ false };
+    };
+
+    // Hand total from the sum with every ace counted as 1 and whether there is an ace
+    constexpr HandValue softTotal(int hardTotal, bool hasAce)
+    {
+        if (hasAce && hardTotal + 10 <= blackjack)
+            return HandValue{ hardTotal + 10, true };
+        return HandValue{ hardTotal, false };
+    }
+
+    // Sum of the values (aces as 1) of the cards set in byte 'byte' of a
+    // CardSet mask, for every value of that byte: two ranks per byte
+    struct HardTotalTables
+    {
+        static constexpr int n_bytes{ (n_cards + 7) / 8 };
+
+        std::uint8_t sums[n_bytes][256]{};
+
+        constexpr HardTotalTables()
+        {
+            for (int byte{ 0 }; byte < n_bytes; ++byte)
+            {
+                for (int pattern{ 0 }; pattern < 256; ++pattern)
+                {
+                    int sum{ 0 };
+                    for (int bit{ 0 }; bit < 8; ++bit)
+                    {
+                        int card{ byte * 8 + bit };
+                        if ((pattern & (1 << bit)) && card < n_cards)
+                        {
+                            Rank rank{ rankOf(card) };
+                            sum += (rank == Rank::rank_A) ? 1 : rank_values[static_cast<int>(rank)];
+                        }
+                    }
+                    sums[byte][pattern] = static_cast<std::uint8_t>(sum);
+                }
+            }
+        }
+    };
+
+    inline constexpr HardTotalTables hard_total_tables{};
+
+    // Set of cards from a single deck, one bit per card index
+    class CardSet
+    {
+    private:
+        std::uint64_t m_bits{ 0 };
+
+        static constexpr std::uint64_t ace_mask{ std::uint64_t{ 0xF } << (static_cast<int>(Rank::rank_A) * n_suits) };
+
+    public:
+        constexpr CardSet() = default;
+        constexpr explicit CardSet(std::uint64_t mask) : m_bits{ mask }
+        {}
+
+        static constexpr CardSet fullDeck()
+        {
+            return CardSet{ (std::uint64_t{ 1 } << n_cards) - 1 };
+        }
+
+        constexpr std::uint64_t mask() const { return m_bits; }
+
+        constexpr void add(int index) { m_bits |= std::uint64_t{ 1 } << index; }
+        constexpr void remove(int index) { m_bits &= ~(std::uint64_t{ 1 } << index); }
+        constexpr bool contains(int index) const { return (m_bits >> index) & 1; }
+        constexpr bool empty() const { return m_bits == 0; }
+
+        int size() const { return __builtin_popcountll(m_bits); }
+
+        // Number of cards of one rank: the popcount of its nibble
+        int count(Rank rank) const
+        {
+            return __builtin_popcountll((m_bits >> (static_cast<int>(rank) * n_suits)) & 0xF);
+        }
+
+        // Lowest card index in the set; set must not be empty
+        int first() const
+        {
+            assert(m_bits && "Empty card set");
+            return __builtin_ctzll(m_bits);
+        }
+
+        // Sum with every ace counted as 1
+        constexpr int hardTotal() const
+        {
+            int total{ 0 };
+            for (int byte{ 0 }; byte < HardTotalTables::n_bytes; ++byte)
+                total += hard_total_tables.sums[byte][(m_bits >> (byte * 8)) & 0xFF];
+            return total;
+        }
+
+        constexpr HandValue handValue() const
+        {
+            return softTotal(hardTotal(), (m_bits & ace_mask) != 0);
+        }
+
+        constexpr CardSet& operator|=(CardSet other) { m_bits |= other.m_bits; return *this; }
+        constexpr CardSet& operator&=(CardSet other) { m_bits &= other.m_bits; return *this; }
+
+        friend constexpr CardSet operator|(CardSet a, CardSet b) { return CardSet{ a.m_bits | b.m_bits }; }
+        friend constexpr CardSet operator&(CardSet a, CardSet b) { return CardSet{ a.m_bits & b.m_bits }; }
+        friend constexpr CardSet operator~(CardSet a) { return CardSet{ ~a.m_bits & fullDeck().m_bits }; }
+        friend constexpr bool operator==(CardSet a, CardSet b) { return a.m_bits == b.m_bits; }
+        friend constexpr bool operator!=(CardSet a, CardSet b) { return a.m_bits != b.m_bits; }
+    };
+
+    // Running hand total that also works with several decks (where a
+    // CardSet cannot hold two of the same card)
+    class Hand
+    {
+    private:
+        int m_hard{ 0 };
+        bool m_ace{ false };
+
+    public:
+        constexpr void add(Rank rank)
+        {
+            m_hard += (rank == Rank::rank_A) ? 1 : Cards::value(rank);
+            m_ace = m_ace || rank == Rank::rank_A;
+        }
+
+        constexpr HandValue value() const { return softTotal(m_hard, m_ace); }
+    };
+}
+
+#endif
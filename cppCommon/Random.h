@@ -0,0 +1,218 @@
+/*  Header file containing the shared random number generator
+ *
+ *  Random::Generator is xoshiro256++: 32 bytes of state, fast, and able to
+ *  jump 2^128 steps ahead, so each thread or run can have its own stream
+ *  that never overlaps another. Every thread gets its own generator.
+ *
+ *  Numbers in a range use Lemire's method (one multiply, rarely a division)
+ *  instead of building a std::uniform_int_distribution on every call.
+ */
+
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string_view>
+
+namespace Random
+{
+    constexpr std::uint64_t splitMix64(std::uint64_t& state)
+    {
+        std::uint64_t z{ (state += 0x9E3779B97F4A7C15ull) };
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // xoshiro256++ (Blackman & Vigna). Works with <random> distributions and
+    // std::shuffle like std::mt19937 does.
+    class Generator
+    {
+    public:
+        using result_type = std::uint64_t;
+
+    private:
+        std::uint64_t s[4]{};
+
+        static constexpr std::uint64_t rotl(std::uint64_t x, int k)
+        {
+            return (x << k) | (x >> (64 - k));
+        }
+
+        constexpr void applyJump(const std::uint64_t (&table)[4])
+        {
+            std::uint64_t t[4]{};
+            for (std::uint64_t word : table)
+            {
+                for (int bit{ 0 }; bit < 64; ++bit)
+                {
+                    if (word & (std::uint64_t{ 1 } << bit))
+                    {
+                        for (int i{ 0 }; i < 4; ++i)
+                            t[i] ^= s[i];
+                    }
+                    (*this)();
+                }
+            }
+            for (int i{ 0 }; i < 4; ++i)
+                s[i] = t[i];
+        }
+
+    public:
+        // State filled from the seed by splitmix64, so similar seeds still
+        // give unrelated streams
+        explicit constexpr Generator(std::uint64_t seed = 0)
+        {
+            for (auto& word : s)
+                word = splitMix64(seed);
+        }
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return ~result_type{ 0 }; }
+
+        constexpr result_type operator()()
+        {
+            std::uint64_t result{ rotl(s[0] + s[3], 23) + s[0] };
+            std::uint64_t t{ s[1] << 17 };
+
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+            s[2] ^= t;
+            s[3] = rotl(s[3], 45);
+
+            return result;
+        }
+
+        // Same as 2^128 calls: gives 2^128 non-overlapping streams of 2^128 numbers
+        constexpr void jump()
+        {
+            constexpr std::uint64_t table[4]{ 0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull,
+                                              0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull };
+            applyJump(table);
+        }
+
+        // Same as 2^192 calls: one per run, then jump() for each thread in it
+        constexpr void longJump()
+        {
+            constexpr std::uint64_t table[4]{ 0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull,
+                                              0x77710069854EE241ull, 0x39109BB02ACBE635ull };
+            applyJump(table);
+        }
+
+        friend bool operator==(const Generator& g1, const Generator& g2)
+        {
+            return g1.s[0] == g2.s[0] && g1.s[1] == g2.s[1] && g1.s[2] == g2.s[2] && g1.s[3] == g2.s[3];
+        }
+    };
+
+    // Seed from a run name (FNV-1a hash), so a run can be repeated by name
+    constexpr std::uint64_t getSeed(std::string_view runId)
+    {
+        std::uint64_t hash{ 0xCBF29CE484222325ull };
+        for (char c : runId)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x100000001B3ull;
+        }
+        return hash;
+    }
+
+    // Generator for stream number 'stream' of a seed: the seed's generator
+    // jumped ahead 'stream' times. Give each thread its own stream number.
+    inline Generator getStream(std::uint64_t seed, int stream)
+    {
+        Generator gen{ seed };
+        for (int i{ 0 }; i < stream; ++i)
+            gen.jump();
+        return gen;
+    }
+
+    // 32 random bits from a 32 or 64-bit engine (top bits are the best ones)
+    template <typename Gen>
+    std::uint32_t getBits32(Gen& gen)
+    {
+        static_assert(Gen::min() == 0 && (Gen::max() == 0xFFFFFFFFu || Gen::max() == ~std::uint64_t{ 0 }),
+                      "Engine must give 32 or 64 full random bits.");
+
+        if constexpr (Gen::max() > 0xFFFFFFFFu)
+            return static_cast<std::uint32_t>(gen() >> 32);
+        else
+            return static_cast<std::uint32_t>(gen());
+    }
+
+    // Unbiased random number in [0, range) from one 32-bit draw (Lemire 2019).
+    // Only retries when the draw falls in the small biased zone.
+    template <typename Gen>
+    std::uint32_t getBounded(Gen& gen, std::uint32_t range)
+    {
+        std::uint64_t product{ static_cast<std::uint64_t>(getBits32(gen)) * range };
+        std::uint32_t low{ static_cast<std::uint32_t>(product) };
+        if (low < range)
+        {
+            std::uint32_t threshold{ static_cast<std::uint32_t>(-range) % range };
+            while (low < threshold)
+            {
+                product = static_cast<std::uint64_t>(getBits32(gen)) * range;
+                low = static_cast<std::uint32_t>(product);
+            }
+        }
+        return static_cast<std::uint32_t>(product >> 32);
+    }
+
+    // Uniform random int in [min, max] from the given generator
+    template <typename Gen>
+    int get(Gen& gen, int min, int max)
+    {
+        std::uint32_t range{ static_cast<std::uint32_t>(max) - static_cast<std::uint32_t>(min) + 1 };
+        if (range == 0)     // whole int range
+            return static_cast<int>(getBits32(gen));
+        return static_cast<int>(static_cast<std::uint32_t>(min) + getBounded(gen, range));
+    }
+
+    // Fills out[0..count) with uniform random ints in [min, max]
+    template <typename Gen>
+    void fill(Gen& gen, int* out, std::size_t count, int min, int max)
+    {
+        for (std::size_t i{ 0 }; i < count; ++i)
+            out[i] = get(gen, min, max);
+    }
+
+    inline std::uint64_t getRandomSeed()
+    {
+        std::random_device rd;
+        std::uint64_t seed{ static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()) };
+        seed ^= (static_cast<std::uint64_t>(rd()) << 32) | rd();
+        return seed;
+    }
+
+    // This thread's generator, self-seeded unless seedThread() was called
+    inline Generator& getGenerator()
+    {
+        thread_local Generator gen{ getRandomSeed() };
+        return gen;
+    }
+
+    // Makes this thread's numbers repeatable: stream 'stream' of seed
+    inline void seedThread(std::uint64_t seed, int stream = 0)
+    {
+        getGenerator() = getStream(seed, stream);
+    }
+
+    // Generate uniform random int in [min, max] from this thread's generator
+    inline int get(int min, int max)
+    {
+        return get(getGenerator(), min, max);
+    }
+
+    inline void fill(int* out, std::size_t count, int min, int max)
+    {
+        fill(getGenerator(), out, count, min, max);
+    }
+}
+
+#endif
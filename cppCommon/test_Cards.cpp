@@ -0,0 +1,102 @@
+#include "Cards.h"
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+int main()
+{
+    std::cout << std::boolalpha;
+
+    // Values and names come from the tables
+    static_assert(Cards::value(Cards::Rank::rank_7) == 7 && Cards::value(Cards::Rank::rank_K) == 10
+                  && Cards::value(Cards::Rank::rank_A) == 11);
+    std::ostringstream names{};
+    names << Cards::name(Cards::Rank::rank_10) << Cards::name(Cards::Suit::Hearts)
+          << Cards::name(Cards::Rank::rank_J) << Cards::name(Cards::Suit::Spades);
+    std::cout << (names.str() == "10HJS" && Cards::name(Cards::Suit::n_suits) == '?') << '\n';
+
+    // Card indices round-trip and cover 0-51 once each
+    Cards::CardSet all{};
+    bool roundTrip{ true };
+    for (int rank{ 0 }; rank < Cards::n_ranks; ++rank)
+    {
+        for (int suit{ 0 }; suit < Cards::n_suits; ++suit)
+        {
+            int index{ Cards::index(static_cast<Cards::Rank>(rank), static_cast<Cards::Suit>(suit)) };
+            if (Cards::rankOf(index) != static_cast<Cards::Rank>(rank) || Cards::suitOf(index) != static_cast<Cards::Suit>(suit))
+                roundTrip = false;
+            all.add(index);
+        }
+    }
+    std::cout << (roundTrip && all == Cards::CardSet::fullDeck() && all.size() == 52
+                  && all.count(Cards::Rank::rank_Q) == 4 && (~all).empty()) << '\n';
+
+    // Hand values, soft and hard (checked at compile time too)
+    constexpr auto card{ [](Cards::Rank rank, Cards::Suit suit) { return Cards::index(rank, suit); } };
+    constexpr Cards::CardSet softHand{ []() {
+        Cards::CardSet hand{};
+        hand.add(Cards::index(Cards::Rank::rank_A, Cards::Suit::Clubs));
+        hand.add(Cards::index(Cards::Rank::rank_6, Cards::Suit::Hearts));
+        return hand;
+    }() };
+    static_assert(softHand.handValue().total == 17 && softHand.handValue().soft);
+
+    Cards::CardSet hand{ softHand };
+    hand.add(card(Cards::Rank::rank_9, Cards::Suit::Spades));
+    Cards::HandValue hard{ hand.handValue() };
+    hand.add(card(Cards::Rank::rank_A, Cards::Suit::Diamonds));
+    Cards::HandValue twoAces{ hand.handValue() };
+    std::cout << (hard.total == 16 && !hard.soft && twoAces.total == 17 && !twoAces.soft) << '\n';
+
+    // Every ace and nothing else: 4 as hard, 14 as soft
+    Cards::CardSet aces{};
+    for (int suit{ 0 }; suit < Cards::n_suits; ++suit)
+        aces.add(card(Cards::Rank::rank_A, static_cast<Cards::Suit>(suit)));
+    std::cout << (aces.hardTotal() == 4 && aces.handValue().total == 14 && aces.handValue().soft
+                  && Cards::CardSet::fullDeck().hardTotal() == 4 * (2 + 3 + 4 + 5 + 6 + 7 + 8 + 9 + 40 + 1)) << '\n';
+
+    // Multi-deck Hand agrees with CardSet for hands without repeats
+    Cards::Hand running{};
+    running.add(Cards::Rank::rank_A);
+    running.add(Cards::Rank::rank_6);
+    running.add(Cards::Rank::rank_A);
+    std::cout << (running.value().total == 18 && running.value().soft) << '\n';
+
+    // Speed of table lookups against summing card by card
+    constexpr int sets{ 1 << 20 };
+    std::uint64_t state{ 12345 };
+    long long tableSum{ 0 };
+    long long loopSum{ 0 };
+    std::chrono::duration<double> tableTime{};
+    std::chrono::duration<double> loopTime{};
+    for (int repeat{ 0 }; repeat < 16; ++repeat)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        Cards::CardSet set{ state & Cards::CardSet::fullDeck().mask() };
+
+        auto start{ std::chrono::steady_clock::now() };
+        for (int i{ 0 }; i < sets; ++i)
+        {
+            tableSum += set.handValue().total;
+            set = Cards::CardSet{ (set.mask() * 0x9E3779B97F4A7C15ull) & Cards::CardSet::fullDeck().mask() };
+        }
+        tableTime += std::chrono::steady_clock::now() - start;
+
+        set = Cards::CardSet{ state & Cards::CardSet::fullDeck().mask() };
+        start = std::chrono::steady_clock::now();
+        for (int i{ 0 }; i < sets; ++i)
+        {
+            Cards::Hand byCard{};
+            for (std::uint64_t bits{ set.mask() }; bits; bits &= bits - 1)
+                byCard.add(Cards::rankOf(__builtin_ctzll(bits)));
+            loopSum += byCard.value().total;
+            set = Cards::CardSet{ (set.mask() * 0x9E3779B97F4A7C15ull) & Cards::CardSet::fullDeck().mask() };
+        }
+        loopTime += std::chrono::steady_clock::now() - start;
+    }
+    std::cout << (tableSum == loopSum) << '\n';
+    std::cout << "Table: " << tableTime.count() * 1e9 / (16.0 * sets) << " ns per hand, card by card: "
+              << loopTime.count() * 1e9 / (16.0 * sets) << " ns per hand\n";
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include "Random.h"
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+int main()
+{
+    std::cout << std::boolalpha;
+
+    // Same seed, same numbers; jumping gives a different stream
+    Random::Generator gen1{ 42 };
+    Random::Generator gen2{ 42 };
+    std::cout << (gen1() == gen2() && gen1 == gen2) << '\n';
+    gen2.jump();
+    std::cout << !(gen1 == gen2) << ' ' << (Random::getStream(42, 1) == Random::getStream(42, 1)) << '\n';
+
+    // Run ids always hash to the same seed
+    std::cout << (Random::getSeed("balance-run-1") == Random::getSeed("balance-run-1")) << ' '
+              << (Random::getSeed("balance-run-1") != Random::getSeed("balance-run-2")) << '\n';
+
+    // Numbers stay in range and every value turns up about equally often
+    // (expect roughly 100000 +/- 2000 each)
+    std::vector<int> numbers(1000000);
+    Random::fill(gen1, numbers.data(), numbers.size(), -3, 6);
+    int counts[10]{};
+    bool inRange{ true };
+    for (int n : numbers)
+    {
+        if (n < -3 || n > 6)
+            inRange = false;
+        else
+            ++counts[n + 3];
+    }
+    bool even{ true };
+    for (int count : counts)
+    {
+        if (count < 98000 || count > 102000)
+            even = false;
+    }
+    std::cout << inRange << ' ' << even << '\n';
+
+    // Works with 32-bit engines too
+    std::mt19937 mt{ 1 };
+    int small{ Random::get(mt, 1, 6) };
+    std::cout << (small >= 1 && small <= 6) << '\n';
+
+    // Each thread has its own generator; seeding one thread doesn't touch another
+    int fromThread{};
+    Random::seedThread(7);
+    int expected{ Random::get(0, 1000000) };
+    std::thread worker{ [&fromThread]()
+    {
+        Random::seedThread(7);
+        fromThread = Random::get(0, 1000000);
+    } };
+    worker.join();
+    std::cout << (fromThread == expected) << '\n';
+
+    // Speed against a new std::uniform_int_distribution per call on std::mt19937
+    constexpr int draws{ 10000000 };
+    long long total{ 0 };
+    auto start{ std::chrono::steady_clock::now() };
+    for (int i{ 0 }; i < draws; ++i)
+    {
+        std::uniform_int_distribution die{ 1, 6 };
+        total += die(mt);
+    }
+    std::chrono::duration<double, std::nano> oldTime{ std::chrono::steady_clock::now() - start };
+
+    start = std::chrono::steady_clock::now();
+    for (int i{ 0 }; i < draws; ++i)
+        total += Random::get(1, 6);
+    std::chrono::duration<double, std::nano> newTime{ std::chrono::steady_clock::now() - start };
+
+    std::cout << "mt19937: " << oldTime.count() / draws << " ns, Random::get: "
+              << newTime.count() / draws << " ns (" << total % 2 << ")\n";
+
+    return 0;
+}
@@ -0,0 +1,206 @@
+/*  Blackjack.h
+
+    Card, Shoe and Player classes and the rules shared by blackjack2.cpp
+    and the headless simulator (see blackjack2.cpp for the rules).
+*/
+
+#ifndef BLACKJACK_H
+#define BLACKJACK_H
+
+#include "CardCounter.h"
+#include "../../../cppCommon/Cards.h"
+#include "../../../cppCommon/Random.h"
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+constexpr int blackjack{ 21 };
+constexpr int dealer_lim{ 17 };
+
+class Card
+{
+public:
+    using Suit = Cards::Suit;
+    using Rank = Cards::Rank;
+
+private:
+    Suit m_suit{};
+    Rank m_rank{};
+
+public:
+    Card() = default;
+
+    Card(Rank rank, Suit suit) : m_suit{ suit }, m_rank{ rank }
+    {}
+
+    // One byte per card, the card's index in Cards (rank * 4 + suit)
+    explicit Card(std::uint8_t packed)
+        : m_suit{ Cards::suitOf(packed) }, m_rank{ Cards::rankOf(packed) }
+    {}
+
+    std::uint8_t pack() const
+    {
+        return static_cast<std::uint8_t>(Cards::index(m_rank, m_suit));
+    }
+
+    Rank rank() const
+    {
+        return m_rank;
+    }
+
+    void print() const
+    {
+        std::cout << Cards::name(m_rank) << Cards::name(m_suit);
+    }
+    
+    int value() const
+    {
+        return Cards::value(m_rank);
+    }
+};
+
+// N decks dealt in random order. Cards are stored packed in one byte each.
+//
+// Shuffling is done one card at a time as cards are dealt (Fisher-Yates run
+// incrementally): each deal picks at random among the cards not yet dealt.
+// So a reshuffle just puts every card back, and only dealt cards cost
+// anything to shuffle. The shoe is reshuffled before the next hand once the
+// cut card (penetration, the fraction of the shoe dealt) has been reached.
+//
+// An attached CardCounter sees every card dealt and is reset on reshuffle.
+class Shoe
+{
+private:
+    std::vector<std::uint8_t> m_cards{};
+    std::size_t m_next{ 0 };            // cards before this have been dealt
+    std::size_t m_handStart{ 0 };       // first card of the hand in play
+    std::size_t m_cutCard{ 0 };
+    Random::Generator m_gen;
+    CardCounter* m_counter{ nullptr };
+
+    // Counter as if the cards in [first, last) were the only ones dealt
+    void recount(std::size_t first, std::size_t last)
+    {
+        if (!m_counter)
+            return;
+        m_counter->reset(m_cards.size());
+        for (std::size_t i{ first }; i < last; ++i)
+            m_counter->add(Cards::rankOf(m_cards[i]));
+    }
+
+    // Ran out mid-hand: keep the cards in play, shuffle the rest back in
+    void reshuffleDiscards()
+    {
+        std::size_t inPlay{ m_next - m_handStart };
+        for (std::size_t i{ 0 }; i < inPlay; ++i)
+            std::swap(m_cards[i], m_cards[m_handStart + i]);
+
+        m_handStart = 0;
+        m_next = inPlay;
+        recount(0, m_next);
+    }
+
+public:
+    // Penetration 0 reshuffles before every hand. Pass a generator to make
+    // the order of the cards repeatable.
+    explicit Shoe(int decks = 1, double penetration = 0.75,
+                  const Random::Generator& gen = Random::Generator{ Random::getRandomSeed() })
+        : m_gen{ gen }
+    {
+        assert(decks > 0 && penetration >= 0.0 && penetration <= 1.0 && "Invalid shoe");
+
+        m_cards.reserve(static_cast<std::size_t>(decks) * Cards::n_cards);
+        for (int deck{ 0 }; deck < decks; ++deck)
+        {
+            for (int card{ 0 }; card < Cards::n_cards; ++card)
+                m_cards.push_back(static_cast<std::uint8_t>(card));
+        }
+
+        m_cutCard = static_cast<std::size_t>(penetration * static_cast<double>(m_cards.size()));
+    }
+
+    // Counter to update as cards are dealt (nullptr for none). It is set
+    // to the count of the cards already dealt.
+    void setCounter(CardCounter* counter)
+    {
+        m_counter = counter;
+        recount(0, m_next);
+    }
+
+    std::size_t size() const { return m_cards.size(); }
+    std::size_t cardsLeft() const { return m_cards.size() - m_next; }
+
+    void print() const
+    {
+        for (std::size_t i{ m_next }; i < m_cards.size(); ++i)
+        {
+            Card{ m_cards[i] }.print();
+            std::cout << ' ';
+        }
+        std::cout << std::endl;
+    }
+
+    // Puts every card back; they are shuffled as they are dealt
+    void shuffle()
+    {
+        m_next = 0;
+        m_handStart = 0;
+        recount(0, 0);
+    }
+
+    // Call before each hand: reshuffles if the cut card has been reached
+    void startHand()
+    {
+        if (m_next >= m_cutCard)
+            shuffle();
+        m_handStart = m_next;
+    }
+
+    std::uint8_t dealPacked()
+    {
+        if (m_next == m_cards.size())
+            reshuffleDiscards();
+
+        std::size_t pick{ m_next + Random::getBounded(m_gen, static_cast<std::uint32_t>(m_cards.size() - m_next)) };
+        std::swap(m_cards[m_next], m_cards[pick]);
+
+        std::uint8_t card{ m_cards[m_next++] };
+        if (m_counter)
+            m_counter->add(Cards::rankOf(card));
+        return card;
+    }
+
+    Card dealCard()
+    {
+        return Card{ dealPacked() };
+    }
+};
+
+class Player
+{
+private:
+    int m_score{ 0 };
+public:
+    int drawCard(Shoe& shoe)
+    {
+        int value = shoe.dealCard().value();
+        m_score += value;
+
+        return value;
+    }
+
+    int score() const
+    {
+        return m_score;
+    }
+
+    bool isBust() const
+    {
+        return (m_score > blackjack);
+    }
+};
+
+#endif
@@ -0,0 +1,87 @@
+/*  CardCounter.h
+
+    Running and true count for the Hi-Lo, KO and Omega II counting systems.
+    A Shoe with a counter attached updates it as each card is dealt: one
+    table lookup and one add per card.
+*/
+
+#ifndef CARD_COUNTER_H
+#define CARD_COUNTER_H
+
+#include "../../../cppCommon/Cards.h"
+#include <cassert>
+#include <cstddef>
+
+class CardCounter
+{
+public:
+    enum System
+    {
+        HiLo,
+        KO,             // unbalanced: a full shoe does not count to 0
+        OmegaII,
+
+        n_systems,
+    };
+
+    static constexpr int cards_per_deck{ Cards::n_cards };
+
+private:
+    // Tag per rank, in Cards::Rank order: 2 3 4 5 6 7 8 9 10 J Q K A
+    static constexpr signed char tags[n_systems][Cards::n_ranks]{
+        {  1,  1,  1,  1,  1,  0,  0,  0, -1, -1, -1, -1, -1 },     // Hi-Lo
+        {  1,  1,  1,  1,  1,  1,  0,  0, -1, -1, -1, -1, -1 },     // KO
+        {  1,  1,  2,  2,  2,  1,  0, -1, -2, -2, -2, -2,  0 },     // Omega II
+    };
+
+    const signed char* m_tags{ tags[HiLo] };
+    System m_system{ HiLo };
+    int m_running{ 0 };
+
+public:
+    explicit CardCounter(System system = HiLo)
+        : m_tags{ tags[system] }, m_system{ system }
+    {
+        assert(system >= 0 && system < n_systems && "Unknown counting system");
+    }
+
+    System system() const { return m_system; }
+
+    static const char* name(System system)
+    {
+        constexpr const char* names[n_systems]{ "Hi-Lo", "KO", "Omega II" };
+        return names[system];
+    }
+
+    // Count for a freshly shuffled shoe of 'cards' cards. KO starts at
+    // 4 - 4 * decks so that its pivot (+4) is the same for any shoe.
+    void reset(std::size_t cards)
+    {
+        m_running = (m_system == KO) ? 4 - 4 * static_cast<int>(cards / cards_per_deck) : 0;
+    }
+
+    void add(Cards::Rank rank)
+    {
+        m_running += m_tags[static_cast<int>(rank)];
+    }
+
+    int runningCount() const { return m_running; }
+
+    // Running count per deck left in the shoe
+    double trueCount(std::size_t cardsLeft) const
+    {
+        return cardsLeft ? static_cast<double>(m_running) * cards_per_deck / static_cast<double>(cardsLeft) : 0.0;
+    }
+
+    // True count rounded down, in integers only
+    int trueCountFloor(std::size_t cardsLeft) const
+    {
+        if (cardsLeft == 0)
+            return 0;
+        long long scaled{ static_cast<long long>(m_running) * cards_per_deck };
+        long long left{ static_cast<long long>(cardsLeft) };
+        return static_cast<int>(scaled / left - ((scaled % left < 0) ? 1 : 0));
+    }
+};
+
+#endif
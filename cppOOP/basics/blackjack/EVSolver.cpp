@@ -0,0 +1,153 @@
+#include "EVSolver.h"
+#include <iomanip>
+
+CardCounts CardCounts::makeDecks(int decks)
+{
+    CardCounts cards{};
+    for (int value{ min_value }; value <= max_value; ++value)
+        cards.add(value, (value == 10) ? 16 * decks : 4 * decks);
+    return cards;
+}
+
+const EVSolver::DealerOdds& EVSolver::getDealerOdds(int dealerScore, const CardCounts& cards)
+{
+    Key key{ cards.packed(), static_cast<std::uint32_t>(dealerScore) };
+    auto found{ m_dealerCache.find(key) };
+    if (found != m_dealerCache.end())
+        return found->second;
+
+    DealerOdds odds{};
+    if (dealerScore > blackjack)
+        odds.back() = 1.0;
+    else if (dealerScore > dealer_lim)
+        odds[dealerScore - lowest_final] = 1.0;
+    else
+    {
+        // Draws on: weight each next card by how many are left
+        for (int value{ CardCounts::min_value }; value <= CardCounts::max_value; ++value)
+        {
+            int count{ cards.count(value) };
+            if (count == 0)
+                continue;
+
+            CardCounts rest{ cards };
+            rest.remove(value);
+            double chance{ static_cast<double>(count) / cards.total() };
+            const DealerOdds& next{ getDealerOdds(dealerScore + value, rest) };
+            for (std::size_t i{ 0 }; i < odds.size(); ++i)
+                odds[i] += chance * next[i];
+        }
+    }
+
+    return m_dealerCache.emplace(key, odds).first->second;
+}
+
+double EVSolver::getStand(int playerScore, int dealerScore, const CardCounts& cards)
+{
+    if (playerScore > blackjack)
+        return -1.0;
+
+    // Win if the dealer busts or finishes lower; ties lose
+    const DealerOdds& odds{ getDealerOdds(dealerScore, cards) };
+    double win{ odds.back() };
+    for (int final{ lowest_final }; final < playerScore; ++final)
+        win += odds[final - lowest_final];
+
+    return 2.0 * win - 1.0;
+}
+
+double EVSolver::getHit(int playerScore, int dealerScore, const CardCounts& cards)
+{
+    if (playerScore > blackjack)
+        return -1.0;
+
+    double ev{ 0.0 };
+    for (int value{ CardCounts::min_value }; value <= CardCounts::max_value; ++value)
+    {
+        int count{ cards.count(value) };
+        if (count == 0)
+            continue;
+
+        CardCounts rest{ cards };
+        rest.remove(value);
+        ev += static_cast<double>(count) / cards.total() * getBest(playerScore + value, dealerScore, rest);
+    }
+    return ev;
+}
+
+double EVSolver::getBest(int playerScore, int dealerScore, const CardCounts& cards)
+{
+    if (playerScore > blackjack)
+        return -1.0;
+
+    Key key{ cards.packed(), static_cast<std::uint32_t>((playerScore << 8) | dealerScore) };
+    auto found{ m_bestCache.find(key) };
+    if (found != m_bestCache.end())
+        return found->second;
+
+    double stand{ getStand(playerScore, dealerScore, cards) };
+    double best{ stand };
+    // Standing on 21 can't be beaten by a hit (every card busts)
+    if (playerScore < blackjack)
+        best = std::max(best, getHit(playerScore, dealerScore, cards));
+
+    m_bestCache.emplace(key, best);
+    return best;
+}
+
+EVSolver::Result EVSolver::evaluate(int playerScore, int dealerScore, const CardCounts& cards)
+{
+    return Result{ getStand(playerScore, dealerScore, cards), getHit(playerScore, dealerScore, cards) };
+}
+
+TableStrategy EVSolver::makeStrategy(const CardCounts& cards)
+{
+    TableStrategy strategy{};
+    for (int upCard{ CardCounts::min_value }; upCard <= CardCounts::max_value; ++upCard)
+    {
+        if (cards.count(upCard) == 0)
+            continue;
+
+        CardCounts rest{ cards };
+        rest.remove(upCard);
+        for (int score{ 2 * CardCounts::min_value }; score <= blackjack; ++score)
+            strategy.setHit(score, upCard, evaluate(score, upCard, rest).shouldHit());
+    }
+    return strategy;
+}
+
+void EVSolver::printTable(std::ostream& out, const CardCounts& cards)
+{
+    out << "Player";
+    for (int upCard{ CardCounts::min_value }; upCard <= CardCounts::max_value; ++upCard)
+        out << std::setw(16) << upCard;
+    out << '\n';
+
+    out << std::fixed << std::setprecision(3);
+    for (int score{ 2 * CardCounts::min_value }; score <= blackjack; ++score)
+    {
+        out << std::setw(6) << score;
+        for (int upCard{ CardCounts::min_value }; upCard <= CardCounts::max_value; ++upCard)
+        {
+            if (cards.count(upCard) == 0)
+            {
+                out << std::setw(16) << '-';
+                continue;
+            }
+
+            CardCounts rest{ cards };
+            rest.remove(upCard);
+            Result result{ evaluate(score, upCard, rest) };
+            out << "  " << (result.shouldHit() ? 'H' : 'S')
+                << std::setw(7) << result.stand << std::setw(7) << result.hit;
+        }
+        out << '\n';
+    }
+    out << std::defaultfloat;
+}
+
+void EVSolver::clearCache()
+{
+    m_dealerCache.clear();
+    m_bestCache.clear();
+}
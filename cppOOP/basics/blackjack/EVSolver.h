@@ -0,0 +1,137 @@
+/*  EVSolver.h
+
+    Exact expected value of hitting and standing for blackjack2.cpp's rules
+    (aces always 11, dealer draws on dealer_lim or less, ties lose), given
+    exactly which cards are left to be dealt.
+
+    Results are cached by (cards left, scores), so repeated questions and
+    the many shared sub-hands of a strategy table are only worked out once.
+*/
+
+#ifndef EV_SOLVER_H
+#define EV_SOLVER_H
+
+#include "Blackjack.h"
+#include "Strategy.h"
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <ostream>
+#include <unordered_map>
+
+// Count of cards left for each card value (2-11, ten to king all count as
+// 10) packed into one 64-bit word: 6 bits per value, 8 bits for the tens.
+// Holds up to 15 decks.
+class CardCounts
+{
+public:
+    static constexpr int min_value{ 2 };
+    static constexpr int max_value{ 11 };
+    static constexpr int n_values{ max_value - min_value + 1 };
+
+private:
+    std::uint64_t m_packed{ 0 };
+    int m_total{ 0 };
+
+    static constexpr int getShift(int value)
+    {
+        // Tens get the top field, the others 6 bits each below it
+        return (value == 10) ? 54 : 6 * ((value < 10) ? value - min_value : value - min_value - 1);
+    }
+
+    static constexpr std::uint64_t getMask(int value)
+    {
+        return (value == 10) ? 0xFF : 0x3F;
+    }
+
+public:
+    CardCounts() = default;
+
+    // Every card of the given number of full decks
+    static CardCounts makeDecks(int decks);
+
+    int count(int value) const
+    {
+        return static_cast<int>((m_packed >> getShift(value)) & getMask(value));
+    }
+
+    int total() const { return m_total; }
+    std::uint64_t packed() const { return m_packed; }
+
+    void add(int value, int cards = 1)
+    {
+        assert(count(value) + cards <= static_cast<int>(getMask(value)) && "Too many cards to count");
+        m_packed += static_cast<std::uint64_t>(cards) << getShift(value);
+        m_total += cards;
+    }
+
+    void remove(int value)
+    {
+        assert(count(value) > 0 && "No card of that value left");
+        m_packed -= std::uint64_t{ 1 } << getShift(value);
+        --m_total;
+    }
+};
+
+class EVSolver
+{
+public:
+    struct Result
+    {
+        double stand{};
+        double hit{};       // playing on perfectly after the hit
+
+        double best() const { return (hit > stand) ? hit : stand; }
+        bool shouldHit() const { return hit > stand; }
+    };
+
+private:
+    // Dealer final scores: 18, 19, 20, 21 (the dealer stands above dealer_lim), bust
+    static constexpr int lowest_final{ dealer_lim + 1 };
+    using DealerOdds = std::array<double, blackjack - dealer_lim + 1>;
+
+    struct Key
+    {
+        std::uint64_t counts{};
+        std::uint32_t scores{};
+
+        friend bool operator==(const Key& k1, const Key& k2)
+        {
+            return k1.counts == k2.counts && k1.scores == k2.scores;
+        }
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& key) const
+        {
+            return static_cast<std::size_t>((key.counts ^ (static_cast<std::uint64_t>(key.scores) << 40))
+                                             * 0x9E3779B97F4A7C15ull);
+        }
+    };
+
+    std::unordered_map<Key, DealerOdds, KeyHash> m_dealerCache{};
+    std::unordered_map<Key, double, KeyHash> m_bestCache{};
+
+    const DealerOdds& getDealerOdds(int dealerScore, const CardCounts& cards);
+    double getStand(int playerScore, int dealerScore, const CardCounts& cards);
+    double getHit(int playerScore, int dealerScore, const CardCounts& cards);
+    double getBest(int playerScore, int dealerScore, const CardCounts& cards);
+
+public:
+    // EVs (in bets, +1 win / -1 loss) for a player on playerScore against a
+    // dealer on dealerScore (the up card), cards being those not yet dealt
+    Result evaluate(int playerScore, int dealerScore, const CardCounts& cards);
+
+    // Best play for every player score against every dealer up card, with
+    // the up card taken out of cards first
+    TableStrategy makeStrategy(const CardCounts& cards);
+
+    // Chart of H/S with both EVs for player scores 4-21 against up cards 2-11
+    void printTable(std::ostream& out, const CardCounts& cards);
+
+    std::size_t cacheSize() const { return m_dealerCache.size() + m_bestCache.size(); }
+    void clearCache();
+};
+
+#endif
@@ -0,0 +1,231 @@
+/*  Simulator.h
+
+    Plays blackjack2.cpp hands with no input or output, against a strategy
+    object instead of the user. The hand loop does no allocation: each
+    thread keeps one Shoe for the whole run.
+
+    runCounted() also keeps a card count and splits the results by the true
+    count at the start of each hand, for bet-spread analysis.
+*/
+
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+#include "Blackjack.h"
+#include "../../../cppCommon/Random.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+namespace Simulator
+{
+    // Same rules as playBlackjack(): +1 if the player wins, -1 if they lose
+    // Calls shoe.startHand() itself; calling it beforehand as well is harmless
+    template <typename Strategy>
+    int playHand(Shoe& shoe, const Strategy& strategy)
+    {
+        shoe.startHand();
+
+        Player dealer{};
+        dealer.drawCard(shoe);
+
+        Player player{};
+        player.drawCard(shoe);
+        player.drawCard(shoe);
+
+        while (!player.isBust() && strategy.shouldHit(player.score(), dealer.score()))
+            player.drawCard(shoe);
+
+        if (player.isBust())
+            return -1;
+
+        // A bust dealer is over dealer_lim too, so this also stops on a bust
+        while (dealer.score() <= dealer_lim)
+            dealer.drawCard(shoe);
+
+        return (dealer.isBust() || player.score() > dealer.score()) ? 1 : -1;
+    }
+
+    // Totals over many hands; per-thread copies are merged at the end
+    class Stats
+    {
+    private:
+        long long m_hands{ 0 };
+        long long m_wins{ 0 };
+        long long m_total{ 0 };         // sum of results (units won)
+        long long m_totalSquares{ 0 };
+
+    public:
+        void add(int result)
+        {
+            ++m_hands;
+            m_wins += (result > 0);
+            m_total += result;
+            m_totalSquares += result * result;
+        }
+
+        void merge(const Stats& other)
+        {
+            m_hands += other.m_hands;
+            m_wins += other.m_wins;
+            m_total += other.m_total;
+            m_totalSquares += other.m_totalSquares;
+        }
+
+        long long hands() const { return m_hands; }
+        long long wins() const { return m_wins; }
+
+        // Average player result per hand; the house edge is minus this
+        double mean() const
+        {
+            return m_hands ? static_cast<double>(m_total) / m_hands : 0.0;
+        }
+
+        double houseEdge() const { return -mean(); }
+
+        // Half-width of the 95% confidence interval of the mean
+        double confidence95() const
+        {
+            if (m_hands < 2)
+                return 0.0;
+            double variance{ (static_cast<double>(m_totalSquares) - m_hands * mean() * mean()) / (m_hands - 1) };
+            return 1.96 * std::sqrt(variance / m_hands);
+        }
+    };
+
+    // Plays 'hands' hands over 'threads' threads, each with its own shoe of
+    // 'decks' decks. Thread n draws from stream n of the seed, so a run is
+    // repeatable. The strategy is shared read-only. Penetration 0 reshuffles
+    // before every hand, as blackjack2.cpp does.
+    template <typename Strategy>
+    Stats run(long long hands, int threads, const Strategy& strategy, std::uint64_t seed,
+              int decks = 1, double penetration = 0.0)
+    {
+        threads = std::max(threads, 1);
+        std::vector<Stats> results(static_cast<std::size_t>(threads));
+        std::vector<std::thread> workers{};
+
+        for (int worker{ 0 }; worker < threads; ++worker)
+        {
+            long long count{ hands / threads + (worker < hands % threads ? 1 : 0) };
+
+            workers.emplace_back([&results, &strategy, worker, count, seed, decks, penetration]()
+            {
+                Shoe shoe{ decks, penetration, Random::getStream(seed, worker) };
+                Stats stats{};
+
+                for (long long hand{ 0 }; hand < count; ++hand)
+                    stats.add(playHand(shoe, strategy));
+                results[worker] = stats;
+            });
+        }
+
+        Stats total{};
+        for (int worker{ 0 }; worker < threads; ++worker)
+        {
+            workers[worker].join();
+            total.merge(results[worker]);
+        }
+        return total;
+    }
+
+    // Stats for each true count (rounded down) at the start of a hand.
+    // Counts beyond +/-max_true_count are put in the end buckets.
+    class CountStats
+    {
+    public:
+        static constexpr int max_true_count{ 10 };
+        static constexpr int n_buckets{ 2 * max_true_count + 1 };
+
+    private:
+        Stats m_buckets[n_buckets]{};
+
+    public:
+        void add(int trueCount, int result)
+        {
+            m_buckets[std::clamp(trueCount, -max_true_count, max_true_count) + max_true_count].add(result);
+        }
+
+        void merge(const CountStats& other)
+        {
+            for (int i{ 0 }; i < n_buckets; ++i)
+                m_buckets[i].merge(other.m_buckets[i]);
+        }
+
+        const Stats& bucket(int trueCount) const
+        {
+            assert(trueCount >= -max_true_count && trueCount <= max_true_count && "True count out of range");
+            return m_buckets[trueCount + max_true_count];
+        }
+
+        Stats total() const
+        {
+            Stats all{};
+            for (const auto& stats : m_buckets)
+                all.merge(stats);
+            return all;
+        }
+
+        // One line per true count that came up:
+        // true_count,hands,frequency,ev,ci95
+        void writeCsv(std::ostream& out) const
+        {
+            long long hands{ total().hands() };
+            out << "true_count,hands,frequency,ev,ci95\n";
+            for (int count{ -max_true_count }; count <= max_true_count; ++count)
+            {
+                const Stats& stats{ bucket(count) };
+                if (stats.hands() == 0)
+                    continue;
+                out << count << ',' << stats.hands() << ',' << static_cast<double>(stats.hands()) / hands << ','
+                    << stats.mean() << ',' << stats.confidence95() << '\n';
+            }
+        }
+    };
+
+    // run(), keeping a count in the given system and splitting the results
+    // by true count
+    template <typename Strategy>
+    CountStats runCounted(long long hands, int threads, const Strategy& strategy, std::uint64_t seed,
+                          int decks, double penetration, CardCounter::System system)
+    {
+        threads = std::max(threads, 1);
+        std::vector<CountStats> results(static_cast<std::size_t>(threads));
+        std::vector<std::thread> workers{};
+
+        for (int worker{ 0 }; worker < threads; ++worker)
+        {
+            long long count{ hands / threads + (worker < hands % threads ? 1 : 0) };
+
+            workers.emplace_back([&results, &strategy, worker, count, seed, decks, penetration, system]()
+            {
+                Shoe shoe{ decks, penetration, Random::getStream(seed, worker) };
+                CardCounter counter{ system };
+                shoe.setCounter(&counter);
+                CountStats stats{};
+
+                for (long long hand{ 0 }; hand < count; ++hand)
+                {
+                    shoe.startHand();
+                    int trueCount{ counter.trueCountFloor(shoe.cardsLeft()) };
+                    stats.add(trueCount, playHand(shoe, strategy));
+                }
+                results[worker] = stats;
+            });
+        }
+
+        CountStats total{};
+        for (int worker{ 0 }; worker < threads; ++worker)
+        {
+            workers[worker].join();
+            total.merge(results[worker]);
+        }
+        return total;
+    }
+}
+
+#endif
@@ -0,0 +1,53 @@
+/*  Strategy.h
+
+    Hit/stand decisions for the headless simulator, in place of asking
+    the user. Any class with a matching shouldHit() const can be used.
+*/
+
+#ifndef STRATEGY_H
+#define STRATEGY_H
+
+#include "Blackjack.h"
+#include <array>
+#include <cassert>
+
+// Hit until the score reaches a fixed total, whatever the dealer has
+class ThresholdStrategy
+{
+private:
+    int m_standOn{};
+
+public:
+    explicit ThresholdStrategy(int standOn = dealer_lim) : m_standOn{ standOn }
+    {}
+
+    bool shouldHit(int playerScore, int /*dealerScore*/) const
+    {
+        return playerScore < m_standOn;
+    }
+};
+
+// Hit/stand chart with one entry per player score and dealer score.
+// Player scores can reach 22 before the first decision (two aces).
+class TableStrategy
+{
+public:
+    static constexpr int max_score{ 32 };
+
+private:
+    std::array<std::array<bool, max_score>, max_score> m_hit{};
+
+public:
+    void setHit(int playerScore, int dealerScore, bool hit)
+    {
+        assert(playerScore < max_score && dealerScore < max_score && "Score outside strategy table");
+        m_hit[playerScore][dealerScore] = hit;
+    }
+
+    bool shouldHit(int playerScore, int dealerScore) const
+    {
+        return m_hit[playerScore][dealerScore];
+    }
+};
+
+#endif
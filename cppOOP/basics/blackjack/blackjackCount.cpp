@@ -0,0 +1,55 @@
+/*  blackjackCount.cpp
+
+    Simulates many hands with a player who hits until reaching a fixed
+    score while counting cards, and writes the player's EV at each true
+    count (rounded down, at the start of the hand) as CSV on stdout.
+
+    Usage: blackjackCount [hands] [hilo|ko|omega2] [decks] [penetration] [stand on score] [threads] [run id]
+*/
+
+#include "CardCounter.h"
+#include "Simulator.h"
+#include "Strategy.h"
+#include "../../../cppCommon/Random.h"
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+int main(int argc, char* argv[])
+{
+    long long hands{ (argc > 1) ? std::stoll(argv[1]) : 100000000 };
+    std::string systemName{ (argc > 2) ? argv[2] : "hilo" };
+    int decks{ (argc > 3) ? std::stoi(argv[3]) : 6 };
+    double penetration{ (argc > 4) ? std::stod(argv[4]) : 0.75 };
+    int standOn{ (argc > 5) ? std::stoi(argv[5]) : dealer_lim };
+    int threads{ (argc > 6) ? std::stoi(argv[6]) : static_cast<int>(std::thread::hardware_concurrency()) };
+    std::string runId{ (argc > 7) ? argv[7] : std::to_string(Random::getRandomSeed()) };
+
+    CardCounter::System system{};
+    if (systemName == "hilo")
+        system = CardCounter::HiLo;
+    else if (systemName == "ko")
+        system = CardCounter::KO;
+    else if (systemName == "omega2")
+        system = CardCounter::OmegaII;
+    else
+    {
+        std::cerr << "Unknown counting system " << systemName << " (hilo, ko or omega2)\n";
+        return 1;
+    }
+
+    auto start{ std::chrono::steady_clock::now() };
+    Simulator::CountStats stats{ Simulator::runCounted(hands, threads, ThresholdStrategy{ standOn },
+                                                       Random::getSeed(runId), decks, penetration, system) };
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    stats.writeCsv(std::cout);
+
+    // Summary on stderr so stdout stays plain CSV
+    std::cerr << CardCounter::name(system) << ", " << decks << " deck(s), penetration " << penetration
+              << ", stand on " << standOn << ", run id: " << runId << '\n';
+    std::cerr << stats.total().hands() / elapsed.count() << " hands/s\n";
+
+    return 0;
+}
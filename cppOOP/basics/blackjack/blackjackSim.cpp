@@ -0,0 +1,42 @@
+/*  blackjackSim.cpp
+
+    Simulates many hands of blackjack2.cpp's Blackjack with a player who
+    hits until reaching a fixed score, and reports the house edge.
+
+    Usage: blackjackSim [hands] [stand on score] [decks] [penetration] [threads] [run id]
+
+    Penetration is the fraction of the shoe dealt before reshuffling
+    (0 reshuffles every hand).
+*/
+
+#include "Simulator.h"
+#include "Strategy.h"
+#include "../../../cppCommon/Random.h"
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+int main(int argc, char* argv[])
+{
+    long long hands{ (argc > 1) ? std::stoll(argv[1]) : 100000000 };
+    int standOn{ (argc > 2) ? std::stoi(argv[2]) : dealer_lim };
+    int decks{ (argc > 3) ? std::stoi(argv[3]) : 6 };
+    double penetration{ (argc > 4) ? std::stod(argv[4]) : 0.75 };
+    int threads{ (argc > 5) ? std::stoi(argv[5]) : static_cast<int>(std::thread::hardware_concurrency()) };
+    std::string runId{ (argc > 6) ? argv[6] : std::to_string(Random::getRandomSeed()) };
+
+    auto start{ std::chrono::steady_clock::now() };
+    Simulator::Stats stats{ Simulator::run(hands, threads, ThresholdStrategy{ standOn }, Random::getSeed(runId),
+                                           decks, penetration) };
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    std::cout << "Stand on " << standOn << ", " << decks << " deck(s), penetration " << penetration
+              << ", run id: " << runId << '\n';
+    std::cout << "Hands: " << stats.hands() << ", won: " << stats.wins() << '\n';
+    std::cout << "House edge: " << 100.0 * stats.houseEdge() << "% +/- "
+              << 100.0 * stats.confidence95() << "% (95%)\n";
+    std::cout << stats.hands() / elapsed.count() << " hands/s\n";
+
+    return 0;
+}
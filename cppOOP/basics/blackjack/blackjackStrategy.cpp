@@ -0,0 +1,27 @@
+/*  blackjackStrategy.cpp
+
+    Prints the exact best play (H or S, then the EV of standing and of
+    hitting) for every player score against every dealer up card.
+
+    Usage: blackjackStrategy [decks]
+*/
+
+#include "EVSolver.h"
+#include <chrono>
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+    int decks{ (argc > 1) ? std::stoi(argv[1]) : 1 };
+
+    EVSolver solver{};
+    auto start{ std::chrono::steady_clock::now() };
+    solver.printTable(std::cout, CardCounts::makeDecks(decks));
+    std::chrono::duration<double, std::milli> elapsed{ std::chrono::steady_clock::now() - start };
+
+    std::cout << decks << " deck(s), " << solver.cacheSize() << " cached positions, "
+              << elapsed.count() << " ms\n";
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include "Blackjack.h"
+#include "CardCounter.h"
+#include "Simulator.h"
+#include "Strategy.h"
+#include <chrono>
+#include <iostream>
+
+int main()
+{
+    std::cout << std::boolalpha;
+
+    // Balanced systems count a whole shoe back to 0; KO ends on +4
+    bool balanced{ true };
+    for (int system{ 0 }; system < CardCounter::n_systems; ++system)
+    {
+        Shoe shoe{ 6, 1.0, Random::Generator{ 1 } };
+        CardCounter counter{ static_cast<CardCounter::System>(system) };
+        shoe.setCounter(&counter);
+        while (shoe.cardsLeft() > 0)
+            shoe.dealPacked();
+        if (counter.runningCount() != ((system == CardCounter::KO) ? 4 : 0))
+            balanced = false;
+    }
+    std::cout << balanced << '\n';
+
+    // Running count matches the cards dealt, and a reshuffle resets it
+    Shoe shoe{ 2, 0.5, Random::Generator{ 2 } };
+    CardCounter hiLo{ CardCounter::HiLo };
+    shoe.setCounter(&hiLo);
+    shoe.startHand();
+    int expected{ 0 };
+    for (int i{ 0 }; i < 60; ++i)
+    {
+        int value{ shoe.dealCard().value() };
+        expected += (value <= 6) ? 1 : (value >= 10) ? -1 : 0;
+    }
+    bool matches{ hiLo.runningCount() == expected };
+    shoe.startHand();
+    std::cout << (matches && hiLo.runningCount() == 0) << '\n';
+
+    // Running out mid-hand counts only the cards still in play
+    Shoe small{ 1, 1.0, Random::Generator{ 3 } };
+    CardCounter omega{ CardCounter::OmegaII };
+    small.setCounter(&omega);
+    for (int i{ 0 }; i < 51; ++i)
+        small.dealPacked();
+    small.startHand();
+    Card last{ small.dealCard() };
+    Card next{ small.dealCard() };      // shoe empty: reshuffled without 'last'
+    CardCounter alone{ CardCounter::OmegaII };
+    alone.reset(small.size());
+    alone.add(last.rank());
+    alone.add(next.rank());
+    std::cout << (omega.runningCount() == alone.runningCount() && small.cardsLeft() == 50) << '\n';
+
+    // True count is the running count per deck left, rounded down
+    CardCounter counter{};
+    counter.add(Card::Rank::rank_2);
+    counter.add(Card::Rank::rank_3);
+    counter.add(Card::Rank::rank_4);
+    std::cout << (counter.trueCount(26) == 6.0 && counter.trueCountFloor(104) == 1
+                  && counter.trueCountFloor(312) == 0) << '\n';
+    counter.reset(52);
+    counter.add(Card::Rank::rank_A);
+    std::cout << (counter.trueCountFloor(104) == -1 && counter.trueCountFloor(52) == -1) << '\n';
+
+    // Every hand lands in one bucket, most of them near a true count of 0
+    Simulator::CountStats stats{ Simulator::runCounted(2000000, 2, ThresholdStrategy{ 17 }, 4, 6, 0.8,
+                                                       CardCounter::HiLo) };
+    long long bucketed{ 0 };
+    for (int count{ -Simulator::CountStats::max_true_count }; count <= Simulator::CountStats::max_true_count; ++count)
+        bucketed += stats.bucket(count).hands();
+    std::cout << (bucketed == 2000000 && stats.total().hands() == 2000000
+                  && stats.bucket(-1).hands() + stats.bucket(0).hands() > 600000) << '\n';
+    stats.writeCsv(std::cout);
+
+    // Cost of counting per hand
+    constexpr long long hands{ 4000000 };
+    auto start{ std::chrono::steady_clock::now() };
+    Simulator::Stats plain{ Simulator::run(hands, 1, ThresholdStrategy{ 17 }, 5, 6, 0.75) };
+    std::chrono::duration<double> plainTime{ std::chrono::steady_clock::now() - start };
+    start = std::chrono::steady_clock::now();
+    Simulator::CountStats counted{ Simulator::runCounted(hands, 1, ThresholdStrategy{ 17 }, 5, 6, 0.75,
+                                                         CardCounter::HiLo) };
+    std::chrono::duration<double> countedTime{ std::chrono::steady_clock::now() - start };
+
+    std::cout << (counted.total().wins() == plain.wins()) << '\n';
+    std::cout << "Plain: " << plain.hands() / plainTime.count() << " hands/s, counted: "
+              << counted.total().hands() / countedTime.count() << " hands/s\n";
+
+    return 0;
+}
@@ -0,0 +1,49 @@
+#include "EVSolver.h"
+#include "Simulator.h"
+#include "Strategy.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+int main()
+{
+    std::cout << std::boolalpha;
+
+    // Packed counts
+    CardCounts deck{ CardCounts::makeDecks(1) };
+    std::cout << (deck.total() == 52 && deck.count(10) == 16 && deck.count(11) == 4) << '\n';
+    CardCounts shoe{ CardCounts::makeDecks(8) };
+    std::cout << (shoe.total() == 416 && shoe.count(10) == 128 && shoe.count(2) == 32) << '\n';
+
+    // Only tens left: dealer on 10 always ends on 20. Player 20 ties (a loss),
+    // hitting busts, so both lose for sure. Player on 11 hits to 21 and wins.
+    CardCounts tens{};
+    tens.add(10, 8);
+    EVSolver solver{};
+    EVSolver::Result twenty{ solver.evaluate(20, 10, tens) };
+    EVSolver::Result eleven{ solver.evaluate(11, 10, tens) };
+    std::cout << (twenty.stand == -1.0 && twenty.hit == -1.0) << ' '
+              << (eleven.hit == 1.0 && eleven.shouldHit()) << '\n';
+
+    // One ten and one five left, dealer on 8: dealer stands on 8 + 10 (18) or
+    // draws 8 + 5 + 10 (23, bust), each half the time. Standing on 17 wins half.
+    CardCounts two{};
+    two.add(10);
+    two.add(5);
+    std::cout << (std::abs(solver.evaluate(17, 8, two).stand) < 1e-12) << ' '
+              << (solver.evaluate(19, 8, two).stand == 1.0) << '\n';
+
+    // Exact strategy beats hitting to 17 in simulation
+    auto start{ std::chrono::steady_clock::now() };
+    TableStrategy exact{ solver.makeStrategy(deck) };
+    std::chrono::duration<double, std::milli> elapsed{ std::chrono::steady_clock::now() - start };
+    std::cout << "Strategy table in " << elapsed.count() << " ms\n";
+
+    Simulator::Stats withTable{ Simulator::run(2000000, 2, exact, 3) };
+    Simulator::Stats withThreshold{ Simulator::run(2000000, 2, ThresholdStrategy{ 17 }, 3) };
+    std::cout << (withTable.houseEdge() + withTable.confidence95()
+                  < withThreshold.houseEdge() - withThreshold.confidence95()) << '\n';
+    std::cout << "House edge " << withTable.houseEdge() << " vs " << withThreshold.houseEdge() << '\n';
+
+    return 0;
+}
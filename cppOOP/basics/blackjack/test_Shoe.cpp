@@ -0,0 +1,94 @@
+#include "Blackjack.h"
+#include "Simulator.h"
+#include "Strategy.h"
+#include "../../../cppCommon/Random.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <random>
+
+int main()
+{
+    std::cout << std::boolalpha;
+
+    // Packing round-trips every card
+    bool packs{ true };
+    for (int rank{ 0 }; rank < Cards::n_ranks; ++rank)
+    {
+        for (int suit{ 0 }; suit < Cards::n_suits; ++suit)
+        {
+            Card card{ static_cast<Card::Rank>(rank), static_cast<Card::Suit>(suit) };
+            if (Card{ card.pack() }.pack() != card.pack() || Card{ card.pack() }.value() != card.value())
+                packs = false;
+        }
+    }
+    std::cout << packs << '\n';
+
+    // Dealing a whole 6-deck shoe gives each card exactly 6 times
+    Shoe shoe{ 6, 1.0, Random::Generator{ 1 } };
+    std::array<int, 256> seen{};
+    for (std::size_t i{ 0 }; i < shoe.size(); ++i)
+        ++seen[shoe.dealPacked()];
+    std::cout << (shoe.size() == 312 && shoe.cardsLeft() == 0
+                  && std::count(seen.begin(), seen.end(), 6) == 52) << '\n';
+
+    // Reshuffles at the cut card, before the next hand
+    Shoe cut{ 1, 0.5, Random::Generator{ 2 } };
+    cut.startHand();
+    for (int i{ 0 }; i < 26; ++i)
+        cut.dealCard();
+    cut.startHand();
+    std::cout << (cut.cardsLeft() == 52) << '\n';
+
+    // Running out mid-hand keeps the hand's cards out of the reshuffle
+    Shoe small{ 1, 1.0, Random::Generator{ 3 } };
+    small.startHand();
+    for (int i{ 0 }; i < 50; ++i)
+        small.dealCard();
+    small.startHand();          // past the cut card only at 52, so no reshuffle
+    small.dealCard();
+    small.dealCard();
+    small.dealCard();           // shoe empty: the 2 cards in play stay out
+    std::cout << (small.cardsLeft() == 49) << '\n';
+
+    // First card is uniform over the 52 (expect roughly 10000 +/- 400 each)
+    std::array<int, 256> first{};
+    Shoe uniform{ 1, 0.0, Random::Generator{ 4 } };
+    for (int i{ 0 }; i < 520000; ++i)
+    {
+        uniform.startHand();
+        ++first[uniform.dealPacked()];
+    }
+    bool even{ true };
+    for (int count : first)
+    {
+        if (count != 0 && (count < 9600 || count > 10400))
+            even = false;
+    }
+    std::cout << even << '\n';
+
+    // Hands per second: full std::shuffle of a deck every hand vs the shoe
+    constexpr long long hands{ 2000000 };
+    std::array<int, 52> deck{};
+    for (int i{ 0 }; i < 52; ++i)
+        deck[i] = i;
+    std::mt19937 mt{ 5 };
+    long long sum{ 0 };
+    auto start{ std::chrono::steady_clock::now() };
+    for (long long hand{ 0 }; hand < hands; ++hand)
+    {
+        std::shuffle(deck.begin(), deck.end(), mt);
+        sum += deck[0];
+    }
+    std::chrono::duration<double> fullShuffle{ std::chrono::steady_clock::now() - start };
+
+    start = std::chrono::steady_clock::now();
+    Simulator::Stats stats{ Simulator::run(hands, 1, ThresholdStrategy{ 17 }, 6, 6, 0.75) };
+    std::chrono::duration<double> simulated{ std::chrono::steady_clock::now() - start };
+
+    std::cout << "Shuffle only: " << hands / fullShuffle.count() << " decks/s, 6-deck shoe simulation: "
+              << stats.hands() / simulated.count() << " hands/s (" << sum % 2 << ")\n";
+
+    return 0;
+}
@@ -0,0 +1,35 @@
+#include "Simulator.h"
+#include "Strategy.h"
+#include <iostream>
+
+int main()
+{
+    std::cout << std::boolalpha;
+
+    // Always hitting always busts: the house wins every hand
+    Simulator::Stats bust{ Simulator::run(10000, 2, ThresholdStrategy{ 100 }, 1) };
+    std::cout << (bust.hands() == 10000 && bust.wins() == 0 && bust.houseEdge() == 1.0) << '\n';
+
+    // Same seed and threads, same results
+    ThresholdStrategy standOn17{ 17 };
+    Simulator::Stats run1{ Simulator::run(100000, 4, standOn17, 7) };
+    Simulator::Stats run2{ Simulator::run(100000, 4, standOn17, 7) };
+    std::cout << (run1.wins() == run2.wins()) << '\n';
+
+    // Table strategy matching the threshold plays the same hands
+    TableStrategy table{};
+    for (int player{ 0 }; player < TableStrategy::max_score; ++player)
+    {
+        for (int dealer{ 0 }; dealer < TableStrategy::max_score; ++dealer)
+            table.setHit(player, dealer, player < 17);
+    }
+    Simulator::Stats run3{ Simulator::run(100000, 4, table, 7) };
+    std::cout << (run3.wins() == run1.wins()) << '\n';
+
+    // Confidence interval shrinks with more hands
+    Simulator::Stats more{ Simulator::run(1000000, 4, standOn17, 7) };
+    std::cout << (more.confidence95() < run1.confidence95()) << '\n';
+    std::cout << "House edge " << more.houseEdge() << " +/- " << more.confidence95() << '\n';
+
+    return 0;
+}
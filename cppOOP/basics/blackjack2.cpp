@@ -26,191 +26,8 @@
     Only keep track of sum of card values, not the specific cards dealt.
 */
 
+#include "blackjack/Blackjack.h"
 #include <iostream>
-#include <array>
-#include <algorithm>
-#include <random>
-#include <cassert>
-#include <vector>
-#include <ctime>
-
-constexpr int blackjack{ 21 };
-constexpr int dealer_lim{ 17 };
-
-class Card
-{
-public:
-    enum Suit
-    {
-        Clubs,
-        Diamonds,
-        Hearts,
-        Spades,
-    
-        n_suits,
-    };
-    
-    enum Rank
-    {
-        rank_2,
-        rank_3,
-        rank_4,
-        rank_5,
-        rank_6,
-        rank_7,
-        rank_8,
-        rank_9,
-        rank_10,
-        rank_J,
-        rank_Q,
-        rank_K,
-        rank_A,
-    
-        n_ranks,
-    };
-
-private:
-    Suit m_suit{};
-    Rank m_rank{};
-
-public:
-    Card() = default;
-
-    Card(Rank rank, Suit suit) : m_rank{ rank }, m_suit{ suit }
-    {}
-
-    void print() const
-    {
-        switch(m_rank)
-        {
-            case Rank::rank_2:      std::cout << '2'; break;
-            case Rank::rank_3:      std::cout << '3'; break;
-            case Rank::rank_4:      std::cout << '4'; break;
-            case Rank::rank_5:      std::cout << '5'; break;
-            case Rank::rank_6:      std::cout << '6'; break;
-            case Rank::rank_7:      std::cout << '7'; break;
-            case Rank::rank_8:      std::cout << '8'; break;
-            case Rank::rank_9:      std::cout << '9'; break;
-            case Rank::rank_10:     std::cout << "10"; break;
-            case Rank::rank_J:      std::cout << 'J'; break;
-            case Rank::rank_Q:      std::cout << 'Q'; break;
-            case Rank::rank_K:      std::cout << 'K'; break;
-            case Rank::rank_A:      std::cout << 'A'; break;
-    
-            default:                std::cout << '?'; break;
-        }   
-        switch(m_suit)
-        {
-            case Suit::Clubs:       std::cout << 'C'; break;
-            case Suit::Diamonds:    std::cout << 'D'; break;
-            case Suit::Hearts:      std::cout << 'H'; break;
-            case Suit::Spades:      std::cout << 'S'; break;
-    
-            default:                std::cout << '?'; break;
-        }   
-    }
-    
-    int value() const
-    {
-        switch(m_rank)
-        {
-            case Rank::rank_2:      return 2; 
-            case Rank::rank_3:      return 3; 
-            case Rank::rank_4:      return 4; 
-            case Rank::rank_5:      return 5; 
-            case Rank::rank_6:      return 6; 
-            case Rank::rank_7:      return 7; 
-            case Rank::rank_8:      return 8; 
-            case Rank::rank_9:      return 9; 
-            case Rank::rank_10:     return 10;
-            case Rank::rank_J:      return 10; 
-            case Rank::rank_Q:      return 10; 
-            case Rank::rank_K:      return 10; 
-            case Rank::rank_A:      return 11; 
-    
-            default:
-                assert(false && "Card rank not in enum class Rank");
-                return 0;
-        }   
-    }
-};
-
-using FullDeck = std::array<Card, 52>;
-using Index = FullDeck::size_type;
-
-class Deck
-{
-private:
-    FullDeck m_deck{};
-    Index m_cardIndex{ static_cast<Index>(0) };
-
-public:
-    Deck()
-    {
-        Index index{ 0 };
-
-        for (int suit{ 0 }; suit < static_cast<int>(Card::n_suits); ++suit)
-        {
-            for (int rank{ 0 }; rank < static_cast<int>(Card::n_ranks); ++rank)
-            {
-                m_deck[index] = { static_cast<Card::Rank>(rank), static_cast<Card::Suit>(suit) };
-                ++index;
-            }
-        }
-    }
-
-    void print() const
-    {
-        for(const auto& card : m_deck)
-        {
-            card.print();
-            std::cout << ' ';
-        }
-        std::cout << std::endl;
-    }
-
-    void shuffle()
-    {
-        // mt static so only seeded once
-        static std::mt19937 mt{ static_cast<std::mt19937::result_type>(std::time(nullptr)) };
-    
-        std::shuffle(m_deck.begin(), m_deck.end(), mt);
-        
-        // reset card m_cardIndex to start at top of deck again
-        m_cardIndex = static_cast<Index>(0);
-    }
-
-    const Card& dealCard()
-    {
-        assert(m_cardIndex < m_deck.size() && "Reached end of deck\n");
-
-        return m_deck[m_cardIndex++];
-    }
-};
-
-class Player
-{
-private:
-    int m_score{ 0 };
-public:
-    int drawCard(Deck& deck)
-    {
-        int value = deck.dealCard().value();
-        m_score += value;
-
-        return value;
-    }
-
-    int score() const
-    {
-        return m_score;
-    }
-
-    bool isBust() const
-    {
-        return (m_score > blackjack);
-    }
-};
 
 bool hitOrStand()
 {
@@ -234,7 +51,7 @@ void printGameStatus(Player& dealer, Player& player)
     std::cout << "Player sum: " << player.score() << std::endl;
 }
 
-bool playerTurn(Deck& deck, Player& player)
+bool playerTurn(Shoe& shoe, Player& player)
 {
     if (player.isBust())
     {
@@ -243,7 +60,7 @@ bool playerTurn(Deck& deck, Player& player)
     }
     else
     {
-        auto playerCard{ player.drawCard(deck) };
+        auto playerCard{ player.drawCard(shoe) };
         std::cout << "You were dealt a " << playerCard << ". Your current score is " << player.score() << '\n';
         
         if (player.isBust())
@@ -258,11 +75,11 @@ bool playerTurn(Deck& deck, Player& player)
     }
 }
 
-void dealerTurn(Deck& deck, Player& dealer)
+void dealerTurn(Shoe& shoe, Player& dealer)
 {
     while (dealer.score() <= dealer_lim)
     {
-        auto dealerCard{ dealer.drawCard(deck) };
+        auto dealerCard{ dealer.drawCard(shoe) };
         std::cout << "The dealer drew a " << dealerCard << ". Their score is now " << dealer.score() << '\n';
 
         if (dealer.isBust())
@@ -274,14 +91,14 @@ void dealerTurn(Deck& deck, Player& dealer)
 
 }
 
-bool playBlackjack(Deck& deck)
+bool playBlackjack(Shoe& shoe)
 {
     Player dealer{};
-    dealer.drawCard(deck);
+    dealer.drawCard(shoe);
 
     Player player{};
-    player.drawCard(deck);
-    player.drawCard(deck);
+    player.drawCard(shoe);
+    player.drawCard(shoe);
 
     printGameStatus(dealer, player);
 
@@ -289,7 +106,7 @@ bool playBlackjack(Deck& deck)
 
     while (action == true)
     {
-        action = playerTurn(deck, player);
+        action = playerTurn(shoe, player);
     }
     
 
@@ -297,7 +114,7 @@ bool playBlackjack(Deck& deck)
         return false; // Player lose
     else
     {
-        dealerTurn(deck, dealer);
+        dealerTurn(shoe, dealer);
 
         if (dealer.isBust() or player.score() > dealer.score())
             return true; // Player win
@@ -311,18 +128,18 @@ bool playBlackjack(Deck& deck)
 int main()
 {
 //  Test Card class
-//  const Card cardQueenHearts{ Card::rank_Q, Card::Hearts };
+//  const Card cardQueenHearts{ Card::Rank::rank_Q, Card::Suit::Hearts };
 //  cardQueenHearts.print();
 //  std::cout << cardQueenHearts.value() << '\n';
 
-//  Test Deck class
-//  Deck deck{};
+//  Test Shoe class
+//  Shoe deck{};
 //  deck.shuffle();
 //  deck.print();
 //  std::cout << deck.dealCard().value() << '\n' << deck.dealCard().value() << '\n';
 
 //  Test Player class
-//  Deck deck{};
+//  Shoe deck{};
 //  deck.shuffle();
 
 //  Player player{};
@@ -339,13 +156,13 @@ int main()
 //  std::cout << "Dealer: " << dealer.score() << '\n';
 
 
-    // Initialise deck
-    Deck deck{};
+    // Initialise single-deck shoe
+    Shoe shoe{};
     // Shuffle deck
-    deck.shuffle();
+    shoe.shuffle();
 
     // Play blackjack
-    bool player_win{ playBlackjack(deck) };
+    bool player_win{ playBlackjack(shoe) };
 
     if (player_win == true)
         std::cout << "Congratualtions! You win!\n";
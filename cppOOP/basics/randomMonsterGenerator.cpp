@@ -5,7 +5,7 @@
  *
  */
 
-#include "Random_MT.h"
+#include "../../cppCommon/Random.h"
 #include <array>
 #include <string>
 #include <string_view>
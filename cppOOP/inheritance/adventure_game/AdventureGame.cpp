@@ -1,5 +1,5 @@
 #include "Creatures.h"
-#include "Random_MT.h"
+#include "../../../cppCommon/Random.h"
 #include <iostream>
 #include <stdexcept>
 #include <string>
@@ -63,7 +63,7 @@ void fightMonster(Player& player)
         }
         else
         {
-            fleeSuccess = static_cast<bool>(RandomMT::getRandomInt(0, 1));
+            fleeSuccess = static_cast<bool>(Random::get(0, 1));
             if (fleeSuccess)
                 break;
             attackPlayer(player, monster);
@@ -1,6 +1,7 @@
+#include "CombatEngine.h"
 #include "Creatures.h"
 #include "Items.h"
-#include "Random_MT.h"
+#include "../../../cppCommon/Random.h"
 #include <iostream>
 #include <stdexcept>
 #include <string>
@@ -15,105 +16,78 @@ std::string getPlayerName()
     return name;
 }
 
-void attackMonster(Player& player, Monster& monster)
+void showPlayerStats(Player& player)
 {
-    monster.reduceHealth(player.getDmgPerHit());
-    std::cout << "You hit the " << monster.getName() << " for " << player.getDmgPerHit() << " damage.\n";
-    if (monster.isDead())
-    {
-        player.levelUp();
-        std::cout << "You are now level " << player.getLevel() << '\n';
-        
-        player.addGold(monster.getGold());
-        std::cout << "You have found " << monster.getGold() << " gold.\n";
-    }
+    std::cout << "\n Player hp: " << player.getHp() << "\t Player dmg: " << player.getDmgPerHit() << '\n';
 }
 
-void attackPlayer(Player& player, Monster& monster)
+void showDeath(const Player& player)
 {
-    player.reduceHealth(monster.getDmgPerHit());
-    std::cout << "The " << monster.getName() << " hit you for " << monster.getDmgPerHit() << " damage.\n";
-    if (player.isDead())
-    {
-        std::cout << "You died at level " << player.getLevel() << " with " << player.getGold() << " gold.\n";
-        std::cout << "Too bad you can't take it with you!\n";
-    }
+    std::cout << "You died at level " << player.getLevel() << " with " << player.getGold() << " gold.\n";
+    std::cout << "Too bad you can't take it with you!\n";
 }
 
-void findPotion(Player& player)
+// The player's choices come from the keyboard; CombatEngine applies the rules
+class KeyboardPolicy : public CombatPolicy
 {
-    int findPotion{ RandomMT::getRandomInt(1, 10) };
-    if (findPotion <= 3)
+public:
+    bool shouldFight(const Player&, const Monster&) override
     {
-        std::cout << "You found a mythical potion! Do you want to drink it? [y/n]: ";
+        std::cout << "(R)un or (F)ight: ";
         char action{};
         std::cin >> action;
 
-        if (action == 'y' || action == 'Y')
-        {
-            Potion potion{ Potion::getRandomPotion() };
-            player.drinkPotion(potion);
-            std::cout << "You drank a " << potion.getSize() << " potion of " << potion.getType() << ".\n";
-
-            if (player.isDead())
-            {
-                std::cout << "You died at level " << player.getLevel() << " with " << player.getGold() << " gold.\n";
-                std::cout << "Too bad you can't take it with you!\n";
-            }
-        }
+        return action == 'f' || action == 'F';
     }
-}
-
-void showPlayerStats(Player& player)
-{
-    std::cout << "\n Player hp: " << player.getHp() << "\t Player dmg: " << player.getDmgPerHit() << '\n';
-}
 
-void fightMonster(Player& player)
-{
-    Monster monster{ Monster::getRandomMonster() };
-    std::cout << "You have encountered a " << monster.getName() << " (" << monster.getSymbol() << ").\n";
-
-    bool fleeSuccess{};
-
-    do 
+    bool shouldDrink(const Player&) override
     {
-        std::cout << "(R)un or (F)ight: ";
+        std::cout << "You found a mythical potion! Do you want to drink it? [y/n]: ";
         char action{};
         std::cin >> action;
 
-        if (action == 'f' || action == 'F')
-        {
-            attackMonster(player, monster);
-            if (!monster.isDead())
-            {
-                attackPlayer(player, monster);
-            }
-        }
-        else
+        return action == 'y' || action == 'Y';
+    }
+
+    void onEncounter(const Monster& monster) override
+    {
+        std::cout << "You have encountered a " << monster.getName() << " (" << monster.getSymbol() << ").\n";
+    }
+
+    void onPlayerHit(const Player& player, const Monster& monster, int damage) override
+    {
+        std::cout << "You hit the " << monster.getName() << " for " << damage << " damage.\n";
+        if (monster.isDead())
         {
-            fleeSuccess = static_cast<bool>(RandomMT::getRandomInt(0, 1));
-            if (fleeSuccess)
-                break;
-            attackPlayer(player, monster);
+            std::cout << "You are now level " << player.getLevel() << '\n';
+            std::cout << "You have found " << monster.getGold() << " gold.\n";
         }
     }
-    while (!player.isDead() && !monster.isDead() && !fleeSuccess);    
 
-    if (!player.isDead() && monster.isDead())
+    void onMonsterHit(const Player& player, const Monster& monster, int damage) override
     {
-        findPotion(player);
+        std::cout << "The " << monster.getName() << " hit you for " << damage << " damage.\n";
+        if (player.isDead())
+            showDeath(player);
     }
 
-}
+    void onPotionDrunk(const Player& player, const Potion& potion) override
+    {
+        std::cout << "You drank a " << potion.getSize() << " potion of " << potion.getType() << ".\n";
+        if (player.isDead())
+            showDeath(player);
+    }
+};
 
 int main()
 {
     Player player{ getPlayerName() };
+    KeyboardPolicy policy{};
+    CombatEngine::GameResult result{};
 
     while (!player.isDead() && !player.hasWon())
     {
-        fightMonster(player);
+        CombatEngine::fightMonster(player, policy, Random::getGenerator(), result);
     }
 
     if (player.hasWon())
@@ -0,0 +1,48 @@
+/*  BalanceAnalyser.cpp
+ *
+ *  Plays many AdventureGame2 games without a player and reports how they went,
+ *  for tuning the monster and potion tables.
+ *
+ *  Usage: BalanceAnalyser [games] [fight|cautious] [threads] [run id]
+ *
+ *  The same run id (any text) always plays the same games.
+ */
+
+#include "BalanceStats.h"
+#include "CombatEngine.h"
+#include "../../../cppCommon/Random.h"
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+int main(int argc, char* argv[])
+{
+    long long games{ (argc > 1) ? std::stoll(argv[1]) : 10000000 };
+    std::string policy{ (argc > 2) ? argv[2] : "fight" };
+    int threads{ (argc > 3) ? std::stoi(argv[3]) : static_cast<int>(std::thread::hardware_concurrency()) };
+    std::string runId{ (argc > 4) ? argv[4] : std::to_string(Random::getRandomSeed()) };
+    std::uint64_t seed{ Random::getSeed(runId) };
+
+    BalanceRunner::PolicyFactory makePolicy{};
+    if (policy == "fight")
+        makePolicy = []() { return std::make_unique<AlwaysFightPolicy>(); };
+    else if (policy == "cautious")
+        makePolicy = []() { return std::make_unique<CautiousPolicy>(); };
+    else
+    {
+        std::cerr << "Unknown policy " << policy << ", use fight or cautious\n";
+        return 1;
+    }
+
+    auto start{ std::chrono::steady_clock::now() };
+    BalanceStats stats{ BalanceRunner::run(games, threads, makePolicy, seed) };
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    std::cout << "Policy: " << policy << ", run id: " << runId << '\n';
+    stats.print(std::cout);
+    std::cout << '\n' << games / elapsed.count() << " games/s\n";
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include "BalanceStats.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+void BalanceStats::add(const CombatEngine::GameResult& result)
+{
+    ++games;
+    levelTotal += result.level;
+    goldTotal += result.gold;
+    ++levels[std::min(result.level, Player::getMaxLevel())];
+    ++gold[std::min(result.gold / gold_bucket_size, gold_buckets - 1)];
+
+    if (result.won)
+        ++wins;
+    else
+        ++deaths[std::min(result.encounters, max_encounters)];
+}
+
+void BalanceStats::merge(const BalanceStats& other)
+{
+    games += other.games;
+    wins += other.wins;
+    levelTotal += other.levelTotal;
+    goldTotal += other.goldTotal;
+    for (std::size_t i{ 0 }; i < levels.size(); ++i)
+        levels[i] += other.levels[i];
+    for (std::size_t i{ 0 }; i < gold.size(); ++i)
+        gold[i] += other.gold[i];
+    for (std::size_t i{ 0 }; i < deaths.size(); ++i)
+        deaths[i] += other.deaths[i];
+}
+
+double BalanceStats::getWinRate() const
+{
+    return games ? static_cast<double>(wins) / games : 0.0;
+}
+
+double BalanceStats::getMeanLevel() const
+{
+    return games ? static_cast<double>(levelTotal) / games : 0.0;
+}
+
+double BalanceStats::getMeanGold() const
+{
+    return games ? static_cast<double>(goldTotal) / games : 0.0;
+}
+
+void BalanceStats::print(std::ostream& out) const
+{
+    out << "Games: " << games << '\n';
+    out << "Win rate: " << getWinRate() << '\n';
+    out << "Mean level: " << getMeanLevel() << '\n';
+    out << "Mean gold: " << getMeanGold() << '\n';
+
+    out << "\nLevel reached\n";
+    for (std::size_t level{ 1 }; level < levels.size(); ++level)
+        out << level << '\t' << levels[level] << '\n';
+
+    out << "\nGold\n";
+    for (int bucket{ 0 }; bucket < gold_buckets; ++bucket)
+    {
+        if (gold[bucket] == 0)
+            continue;
+        out << bucket * gold_bucket_size;
+        if (bucket == gold_buckets - 1)
+            out << "+";
+        else
+            out << '-' << (bucket + 1) * gold_bucket_size - 1;
+        out << '\t' << gold[bucket] << '\n';
+    }
+
+    out << "\nDeaths by monsters met\n";
+    for (int encounters{ 1 }; encounters <= max_encounters; ++encounters)
+    {
+        if (deaths[encounters] == 0)
+            continue;
+        out << encounters << (encounters == max_encounters ? "+" : "") << '\t' << deaths[encounters] << '\n';
+    }
+}
+
+namespace BalanceRunner
+{
+    BalanceStats run(long long games, int threads, const PolicyFactory& makePolicy, std::uint64_t seed)
+    {
+        threads = std::max(threads, 1);
+        std::vector<BalanceStats> results(static_cast<std::size_t>(threads));
+        std::vector<std::thread> workers{};
+
+        for (int worker{ 0 }; worker < threads; ++worker)
+        {
+            // Split games as evenly as possible
+            long long count{ games / threads + (worker < games % threads ? 1 : 0) };
+
+            workers.emplace_back([&results, &makePolicy, worker, count, seed]()
+            {
+                Random::Generator gen{ Random::getStream(seed, worker) };
+                std::unique_ptr<CombatPolicy> policy{ makePolicy() };
+
+                // Accumulate locally, the shared vector is only written once
+                BalanceStats stats{};
+                for (long long game{ 0 }; game < count; ++game)
+                    stats.add(CombatEngine::playGame(*policy, gen));
+                results[worker] = stats;
+            });
+        }
+
+        BalanceStats total{};
+        for (int worker{ 0 }; worker < threads; ++worker)
+        {
+            workers[worker].join();
+            total.merge(results[worker]);
+        }
+        return total;
+    }
+}
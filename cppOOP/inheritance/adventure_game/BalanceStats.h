@@ -0,0 +1,59 @@
+#ifndef BALANCE_STATS_H
+#define BALANCE_STATS_H
+
+#include "CombatEngine.h"
+#include "Creatures.h"
+#include "../../../cppCommon/Random.h"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ostream>
+
+// Totals over many simulated games, for checking the monster and potion
+// tables. Each thread fills its own copy and the copies are merged at the end.
+class BalanceStats
+{
+public:
+    static constexpr int gold_bucket_size{ 100 };
+    static constexpr int gold_buckets{ 32 };          // last bucket holds everything above
+    static constexpr int max_encounters{ 64 };        // last bucket holds everything above
+
+private:
+    long long games{ 0 };
+    long long wins{ 0 };
+    long long levelTotal{ 0 };
+    long long goldTotal{ 0 };
+    std::array<long long, Player::getMaxLevel() + 1> levels{};
+    std::array<long long, gold_buckets> gold{};
+    std::array<long long, max_encounters + 1> deaths{};   // games lost after n encounters
+
+public:
+    void add(const CombatEngine::GameResult& result);
+    void merge(const BalanceStats& other);
+
+    long long getGames() const { return games; }
+    long long getWins() const { return wins; }
+    double getWinRate() const;
+    double getMeanLevel() const;
+    double getMeanGold() const;
+
+    // Games ending at each level, in each gold bucket, and lost after n encounters
+    long long getLevelCount(int level) const { return levels[level]; }
+    long long getGoldCount(int bucket) const { return gold[bucket]; }
+    long long getDeathCount(int encounters) const { return deaths[encounters]; }
+
+    void print(std::ostream& out) const;
+};
+
+namespace BalanceRunner
+{
+    // Each thread asks for its own policy, so policies may keep state
+    using PolicyFactory = std::function<std::unique_ptr<CombatPolicy>()>;
+
+    // Plays 'games' games spread over 'threads' threads. Thread n draws from
+    // stream n of the seed, so a run is repeatable and no two threads overlap.
+    BalanceStats run(long long games, int threads, const PolicyFactory& makePolicy, std::uint64_t seed);
+}
+
+#endif
@@ -0,0 +1,93 @@
+#include "CombatEngine.h"
+#include "Creatures.h"
+#include "Items.h"
+#include "../../../cppCommon/Random.h"
+
+bool CautiousPolicy::shouldFight(const Player& player, const Monster& monster)
+{
+    // Hits each side needs to kill the other; the player strikes first
+    int hitsToKill{ (monster.getHp() + player.getDmgPerHit() - 1) / player.getDmgPerHit() };
+    int hitsToDie{ (player.getHp() + monster.getDmgPerHit() - 1) / monster.getDmgPerHit() };
+
+    return hitsToKill <= hitsToDie;
+}
+
+namespace CombatEngine
+{
+    namespace
+    {
+        void attackMonster(Player& player, Monster& monster, CombatPolicy& policy)
+        {
+            int damage{ player.getDmgPerHit() };
+            monster.reduceHealth(damage);
+            if (monster.isDead())
+            {
+                player.levelUp();
+                player.addGold(monster.getGold());
+            }
+            policy.onPlayerHit(player, monster, damage);
+        }
+
+        void attackPlayer(Player& player, const Monster& monster, CombatPolicy& policy)
+        {
+            player.reduceHealth(monster.getDmgPerHit());
+            policy.onMonsterHit(player, monster, monster.getDmgPerHit());
+        }
+
+        void findPotion(Player& player, CombatPolicy& policy, Random::Generator& gen)
+        {
+            // 30% chance of a potion after each monster killed
+            if (Random::get(gen, 1, 10) <= 3 && policy.shouldDrink(player))
+            {
+                Potion potion{ Potion::getRandomPotion(gen) };
+                player.drinkPotion(potion);
+                policy.onPotionDrunk(player, potion);
+            }
+        }
+    }
+
+    void fightMonster(Player& player, CombatPolicy& policy, Random::Generator& gen, GameResult& result)
+    {
+        Monster monster{ Monster::getRandomMonster(gen) };
+        ++result.encounters;
+        policy.onEncounter(monster);
+
+        bool fleeSuccess{};
+
+        do
+        {
+            ++result.rounds;
+            if (policy.shouldFight(player, monster))
+            {
+                attackMonster(player, monster, policy);
+                if (!monster.isDead())
+                    attackPlayer(player, monster, policy);
+            }
+            else
+            {
+                fleeSuccess = static_cast<bool>(Random::get(gen, 0, 1));
+                if (fleeSuccess)
+                    break;
+                attackPlayer(player, monster, policy);
+            }
+        }
+        while (!player.isDead() && !monster.isDead() && !fleeSuccess);
+
+        if (!player.isDead() && monster.isDead())
+            findPotion(player, policy, gen);
+    }
+
+    GameResult playGame(CombatPolicy& policy, Random::Generator& gen)
+    {
+        Player player{ "sim" };
+        GameResult result{};
+
+        while (!player.isDead() && !player.hasWon())
+            fightMonster(player, policy, gen, result);
+
+        result.won = player.hasWon();
+        result.level = player.getLevel();
+        result.gold = player.getGold();
+        return result;
+    }
+}
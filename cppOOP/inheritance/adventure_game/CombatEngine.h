@@ -0,0 +1,63 @@
+#ifndef COMBAT_ENGINE_H
+#define COMBAT_ENGINE_H
+
+#include "Creatures.h"
+#include "Items.h"
+#include "../../../cppCommon/Random.h"
+
+// Decisions the player makes during a game, in place of typing them in
+class CombatPolicy
+{
+public:
+    virtual ~CombatPolicy() = default;
+
+    // true to attack, false to try to run away
+    virtual bool shouldFight(const Player& player, const Monster& monster) = 0;
+
+    // true to drink a potion found after a fight (its type is only known once drunk)
+    virtual bool shouldDrink(const Player& player) = 0;
+
+    // Told what happened, after the rules have applied it; a simulation ignores these
+    virtual void onEncounter(const Monster&) {}
+    virtual void onPlayerHit(const Player&, const Monster&, int /*damage*/) {}     // monster may now be dead
+    virtual void onMonsterHit(const Player&, const Monster&, int /*damage*/) {}    // player may now be dead
+    virtual void onPotionDrunk(const Player&, const Potion&) {}
+};
+
+// Fight everything, drink everything
+class AlwaysFightPolicy : public CombatPolicy
+{
+public:
+    bool shouldFight(const Player&, const Monster&) override { return true; }
+    bool shouldDrink(const Player&) override { return true; }
+};
+
+// Run from monsters that would win the fight, never drink on 1 hp (poison kills)
+class CautiousPolicy : public CombatPolicy
+{
+public:
+    bool shouldFight(const Player& player, const Monster& monster) override;
+    bool shouldDrink(const Player& player) override { return player.getHp() > 1; }
+};
+
+// The rules of AdventureGame2, which plays them through a policy that asks
+// the player; simulations use policies with no input or output
+namespace CombatEngine
+{
+    struct GameResult
+    {
+        bool won{};
+        int level{};
+        int gold{};
+        int encounters{};   // monsters met, including the one that ended the game
+        int rounds{};       // fight/run choices made
+    };
+
+    // One encounter with a random monster, then maybe a potion
+    void fightMonster(Player& player, CombatPolicy& policy, Random::Generator& gen, GameResult& result);
+
+    // Plays until the player wins (hasWon()) or dies
+    GameResult playGame(CombatPolicy& policy, Random::Generator& gen);
+}
+
+#endif
@@ -1,6 +1,6 @@
 #include "Creatures.h"
 #include "Items.h"
-#include "Random_MT.h"
+#include "../../../cppCommon/Random.h"
 #include <array>
 
 /*
@@ -66,7 +66,12 @@ const Creature& Monster::getDefaultCreature(Type type)
 
 Monster Monster::getRandomMonster()
 {
-    int number{ RandomMT::getRandomInt(0, static_cast<Type>(Type::max_monster_types - 1)) };
+    return getRandomMonster(Random::getGenerator());
+}
+
+Monster Monster::getRandomMonster(Random::Generator& gen)
+{
+    int number{ Random::get(gen, 0, static_cast<Type>(Type::max_monster_types - 1)) };
 
     return Monster{ static_cast<Type>(number) };
 }
@@ -2,6 +2,7 @@
 #define CREATURES_H
 
 #include "Items.h"
+#include "../../../cppCommon/Random.h"
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -50,6 +51,7 @@ public:
 
     //getters
     int getLevel() const { return level; }
+    static constexpr int getMaxLevel() { return player_max_level; }
 
     // add functions
     void levelUp();
@@ -80,6 +82,7 @@ public:
 
     // random monster generator
     static Monster getRandomMonster();
+    static Monster getRandomMonster(Random::Generator& gen);
 
 };
 
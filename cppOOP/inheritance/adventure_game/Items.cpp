@@ -1,5 +1,5 @@
 #include "Items.h"
-#include "Random_MT.h"
+#include "../../../cppCommon/Random.h"
 #include <array>
 #include <cassert>
 #include <string_view>
@@ -35,8 +35,13 @@ Potion::Potion(Type t, Size s)
 
 Potion Potion::getRandomPotion()
 {
-    int n_type{ RandomMT::getRandomInt(0, static_cast<int>(Type::max_potion_type - 1)) };
-    int n_size{ RandomMT::getRandomInt(0, static_cast<int>(Size::max_potion_size - 1)) };
+    return getRandomPotion(Random::getGenerator());
+}
+
+Potion Potion::getRandomPotion(Random::Generator& gen)
+{
+    int n_type{ Random::get(gen, 0, static_cast<int>(Type::max_potion_type - 1)) };
+    int n_size{ Random::get(gen, 0, static_cast<int>(Size::max_potion_size - 1)) };
     Type type{ static_cast<Type>(n_type) };
     Size size{ static_cast<Size>(n_size) };
 
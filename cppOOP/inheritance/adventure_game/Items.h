@@ -1,6 +1,7 @@
 #ifndef ITEMS_H
 #define ITEMS_H
 
+#include "../../../cppCommon/Random.h"
 #include <string_view>
 #include <utility>
 
@@ -41,6 +42,7 @@ public:
     Potion(Type type, Size size);
 
     static Potion getRandomPotion();
+    static Potion getRandomPotion(Random::Generator& gen);
     int getHP() const { return hp; }
     int getDMG() const { return dmg; }
     std::string_view getType() const;
@@ -0,0 +1,75 @@
+#include "../BalanceStats.h"
+#include "../CombatEngine.h"
+#include <iostream>
+#include <memory>
+
+int main()
+{
+    std::cout << std::boolalpha;
+
+    // Hand-made results land in the right buckets
+    BalanceStats stats{};
+    stats.add(CombatEngine::GameResult{ true, 20, 1250, 30, 60 });
+    stats.add(CombatEngine::GameResult{ false, 3, 40, 5, 9 });
+    std::cout << (stats.getGames() == 2 && stats.getWins() == 1) << ' '
+              << (stats.getMeanLevel() == 11.5) << ' '
+              << (stats.getLevelCount(20) == 1 && stats.getLevelCount(3) == 1) << ' '
+              << (stats.getGoldCount(12) == 1 && stats.getGoldCount(0) == 1) << ' '
+              << (stats.getDeathCount(5) == 1) << '\n';
+
+    // Merging adds everything up
+    BalanceStats merged{};
+    merged.merge(stats);
+    merged.merge(stats);
+    std::cout << (merged.getGames() == 4 && merged.getDeathCount(5) == 2 && merged.getWinRate() == 0.5) << '\n';
+
+    // Same seed and thread count, same totals
+    auto makePolicy{ []() { return std::make_unique<AlwaysFightPolicy>(); } };
+    BalanceStats run1{ BalanceRunner::run(100000, 4, makePolicy, 7) };
+    BalanceStats run2{ BalanceRunner::run(100000, 4, makePolicy, 7) };
+    std::cout << (run1.getGames() == 100000 && run1.getWins() == run2.getWins()
+                  && run1.getMeanGold() == run2.getMeanGold()) << '\n';
+
+    // Every game is counted once in each histogram, and deaths only for losses
+    long long levelGames{ 0 };
+    for (int level{ 0 }; level <= Player::getMaxLevel(); ++level)
+        levelGames += run1.getLevelCount(level);
+    long long goldGames{ 0 };
+    for (int bucket{ 0 }; bucket < BalanceStats::gold_buckets; ++bucket)
+        goldGames += run1.getGoldCount(bucket);
+    long long deathGames{ 0 };
+    for (int encounters{ 0 }; encounters <= BalanceStats::max_encounters; ++encounters)
+        deathGames += run1.getDeathCount(encounters);
+    std::cout << (levelGames == run1.getGames() && goldGames == run1.getGames()
+                  && deathGames == run1.getGames() - run1.getWins()
+                  && run1.getLevelCount(Player::getMaxLevel()) == run1.getWins()) << ' '
+              << (run1.getWinRate() == static_cast<double>(run1.getWins()) / run1.getGames()
+                  && run1.getWinRate() > 0.0 && run1.getWinRate() < 0.1) << '\n';
+
+    // The merged run equals each thread's games (stream n of the seed) added up
+    BalanceStats byThread{};
+    for (int thread{ 0 }; thread < 4; ++thread)
+    {
+        Random::Generator gen{ Random::getStream(7, thread) };
+        AlwaysFightPolicy policy{};
+        BalanceStats stats{};
+        for (int game{ 0 }; game < 25000; ++game)
+            stats.add(CombatEngine::playGame(policy, gen));
+        byThread.merge(stats);
+    }
+    bool sameHistograms{ true };
+    for (int level{ 0 }; level <= Player::getMaxLevel(); ++level)
+        sameHistograms = sameHistograms && byThread.getLevelCount(level) == run1.getLevelCount(level);
+    for (int bucket{ 0 }; bucket < BalanceStats::gold_buckets; ++bucket)
+        sameHistograms = sameHistograms && byThread.getGoldCount(bucket) == run1.getGoldCount(bucket);
+    for (int encounters{ 0 }; encounters <= BalanceStats::max_encounters; ++encounters)
+        sameHistograms = sameHistograms && byThread.getDeathCount(encounters) == run1.getDeathCount(encounters);
+    std::cout << (byThread.getGames() == run1.getGames() && byThread.getWins() == run1.getWins()
+                  && byThread.getMeanLevel() == run1.getMeanLevel() && byThread.getMeanGold() == run1.getMeanGold())
+              << ' ' << sameHistograms << '\n';
+
+    std::cout << "Win rate " << run1.getWinRate() << ", mean level " << run1.getMeanLevel() << ", mean gold "
+              << run1.getMeanGold() << '\n';
+
+    return 0;
+}
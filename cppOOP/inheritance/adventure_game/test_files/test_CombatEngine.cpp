@@ -0,0 +1,45 @@
+#include "../CombatEngine.h"
+#include "../Creatures.h"
+#include <chrono>
+#include <iostream>
+#include <random>
+
+int main()
+{
+    std::cout << std::boolalpha;
+
+    // Every game ends in a win or a death
+    Random::Generator gen{ 12345 };
+    AlwaysFightPolicy reckless{};
+    CombatEngine::GameResult result{ CombatEngine::playGame(reckless, gen) };
+    std::cout << (result.won == (result.level >= 20)) << ' ' << (result.encounters > 0) << '\n';
+
+    // Same seed, same game
+    Random::Generator gen1{ 42 };
+    Random::Generator gen2{ 42 };
+    CombatEngine::GameResult first{ CombatEngine::playGame(reckless, gen1) };
+    CombatEngine::GameResult second{ CombatEngine::playGame(reckless, gen2) };
+    std::cout << (first.level == second.level && first.gold == second.gold && first.rounds == second.rounds) << '\n';
+
+    // Cautious player only fights what it can beat
+    Player player{ "test" };
+    CautiousPolicy cautious{};
+    std::cout << cautious.shouldFight(player, Monster{ Monster::slime }) << ' '
+              << !cautious.shouldFight(player, Monster{ Monster::dragon }) << '\n';
+
+    // Speed and win rate of each policy
+    constexpr int games{ 1000000 };
+    for (CombatPolicy* policy : { static_cast<CombatPolicy*>(&reckless), static_cast<CombatPolicy*>(&cautious) })
+    {
+        int wins{ 0 };
+        auto start{ std::chrono::steady_clock::now() };
+        for (int count{ 0 }; count < games; ++count)
+            wins += CombatEngine::playGame(*policy, gen).won;
+        std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+        std::cout << "Win rate " << static_cast<double>(wins) / games << ", "
+                  << games / elapsed.count() << " games/s\n";
+    }
+
+    return 0;
+}
@@ -1,5 +1,5 @@
 #include "../Creatures.h"
-#include "../Random_MT.h"
+#include "../../../../cppCommon/Random.h"
 #include <iostream>
 
 int main()
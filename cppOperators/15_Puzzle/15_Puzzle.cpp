@@ -1,20 +1,118 @@
+#include "BatchSolver.h"
 #include "Board.h"
+#include "MoveLog.h"
+#include "PatternDatabase.h"
+#include "Renderer.h"
 #include "UserInput.h"
+#include <chrono>
+#include <fstream>
 #include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
 
-int main()
+// 15_Puzzle --batch <boards file> [threads] [pattern database file]
+// Solves every board in the file optimally, one line per board as it finishes:
+// instance, solution length, nodes expanded, milliseconds.
+int runBatch(int argc, char* argv[])
 {
+    if (argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " --batch <boards file> [threads] [pattern database file]\n";
+        return 1;
+    }
+
+    std::ifstream file{ argv[2] };
+    if (!file)
+    {
+        std::cerr << "Could not open " << argv[2] << '\n';
+        return 1;
+    }
+
+    std::vector<Board> boards{};
+    std::string error{};
+    if (!BatchSolver::readBoards(file, boards, error))
+    {
+        std::cerr << argv[2] << ", " << error << '\n';
+        return 1;
+    }
+
+    int threads{ (argc > 3) ? std::stoi(argv[3]) : static_cast<int>(std::thread::hardware_concurrency()) };
+
+    // Without a pattern database the solver falls back to Manhattan distance + linear conflict
+    PatternDatabase database{ (argc > 4) ? argv[4] : "" };
+    if (argc > 4 && !database.isLoaded())
+    {
+        std::cerr << "Could not load pattern database " << argv[4] << '\n';
+        return 1;
+    }
+
+    BatchSolver solver{ threads, &database };
+    long long totalNodes{ 0 };
+    auto start{ std::chrono::steady_clock::now() };
+
+    std::cout << "instance length nodes ms\n";
+    solver.solve(boards, [&totalNodes](const BatchSolver::Result& result)
+    {
+        totalNodes += result.nodes;
+        std::cout << result.instance << ' ' << result.length << ' ' << result.nodes << ' '
+                  << result.milliseconds << std::endl;
+    });
+
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+    std::cout << "Solved " << boards.size() << " boards in " << elapsed.count() << " s, "
+              << totalNodes / elapsed.count() << " nodes/s\n";
+    return 0;
+}
+
+// Adds a game to the end of a move log, starting the log if it is new
+bool appendGame(const char* filename, const MoveLog& game)
+{
+    bool isNew{ true };
+    {
+        std::ifstream existing{ filename, std::ios::binary };
+        if (existing && existing.peek() != std::ifstream::traits_type::eof())
+        {
+            std::string error{};
+            if (!MoveLog::readHeader(existing, error))
+            {
+                std::cerr << filename << ": " << error << '\n';
+                return false;
+            }
+            isNew = false;
+        }
+    }
+
+    std::ofstream file{ filename, std::ios::binary | std::ios::app };
+    if (isNew)
+        MoveLog::writeHeader(file);
+    game.write(file);
+    return static_cast<bool>(file);
+}
+
+// 15_Puzzle [--record <log file>]: play a game, adding it to the log if given
+int main(int argc, char* argv[])
+{
+    if (argc > 1 && std::string{ argv[1] } == "--batch")
+        return runBatch(argc, argv);
+
+    const char* logFile{ (argc > 2 && std::string{ argv[1] } == "--record") ? argv[2] : nullptr };
+
     Board board{};
     board.randomise();
     Board completeBoard{};
-    std::cout << board;
+    MoveLog game{ board };
+
+    // Redraws the board in place instead of scrolling
+    Renderer renderer{ Renderer::cursorHome };
+    renderer.draw(board);
 
     while (true)
     {
         if (board == completeBoard)
         {
             std::cout << "You win!\n";
-            return 0;
+            return (logFile && !appendGame(logFile, game)) ? 1 : 0;
         }
 
         std::cout << "Enter a command: ";
@@ -23,14 +121,17 @@ int main()
         if (command == 'q')
         {
             std::cout << "\n\nBye!\n\n";
-            return 0;
+            return (logFile && !appendGame(logFile, game)) ? 1 : 0;
         }
 
         Direction dir{ UserInput::charToDirection(command) };
         
         bool userMove{ board.swapExecuted(dir) };
         if (userMove)
-            std::cout << board;
+        {
+            game.record(dir);
+            renderer.draw(board);
+        }
     }
 
     return 0;
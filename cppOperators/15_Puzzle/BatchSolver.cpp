@@ -0,0 +1,374 @@
+#include "BatchSolver.h"
+#include "PackedBoard.h"
+#include "Solver.h"
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int root_task{ -1 };
+
+    // Split a hard board into about this many subtrees per worker, so workers
+    // that draw easy subtrees can steal more
+    constexpr int subtrees_per_thread{ 16 };
+
+    struct Task
+    {
+        int instance{};
+        int subtree{ root_task };
+    };
+
+    // Board reached after the first few moves of a search
+    struct Subtree
+    {
+        PackedBoard board{};
+        std::vector<Direction> prefix{};
+        int lastDir{ -1 };
+    };
+
+    struct Instance
+    {
+        Board board{};
+        Clock::time_point start{};
+
+        // Filled in when the board is split, read-only afterwards
+        std::vector<Subtree> subtrees{};
+
+        // Current pass over the subtrees
+        int bound{ 0 };
+        std::atomic<int> remaining{ 0 };
+        std::atomic<int> nextBound{ std::numeric_limits<int>::max() };
+
+        std::atomic<bool> solved{ false };
+        std::atomic<long long> nodes{ 0 };
+        std::mutex solutionMutex{};
+        std::vector<Direction> solution{};
+    };
+
+    // One double-ended queue per worker: the owner pushes and pops at the back
+    // (depth-first, cache-warm), thieves take from the front.
+    class TaskPool
+    {
+    private:
+        struct Queue
+        {
+            std::mutex mutex{};
+            std::deque<Task> tasks{};
+        };
+
+        std::vector<Queue> queues;
+        std::atomic<long long> pending{ 0 };    // pushed but not yet finished
+
+    public:
+        explicit TaskPool(int workers)
+            : queues(static_cast<std::size_t>(workers))
+        {}
+
+        void push(int worker, const Task& task)
+        {
+            ++pending;
+            std::lock_guard<std::mutex> lock{ queues[worker].mutex };
+            queues[worker].tasks.push_back(task);
+        }
+
+        bool pop(int worker, Task& task)
+        {
+            {
+                std::lock_guard<std::mutex> lock{ queues[worker].mutex };
+                if (!queues[worker].tasks.empty())
+                {
+                    task = queues[worker].tasks.back();
+                    queues[worker].tasks.pop_back();
+                    return true;
+                }
+            }
+
+            int workers{ static_cast<int>(queues.size()) };
+            for (int offset{ 1 }; offset < workers; ++offset)
+            {
+                Queue& victim{ queues[(worker + offset) % workers] };
+                std::lock_guard<std::mutex> lock{ victim.mutex };
+                if (!victim.tasks.empty())
+                {
+                    task = victim.tasks.front();
+                    victim.tasks.pop_front();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void finished() { --pending; }
+        bool hasPending() const { return pending.load() > 0; }
+    };
+
+    void lowerTo(std::atomic<int>& value, int candidate)
+    {
+        int current{ value.load() };
+        while (candidate < current && !value.compare_exchange_weak(current, candidate))
+        {
+        }
+    }
+
+    // Every board 'depth' moves from the start (never undoing the last move),
+    // stopping early once there are at least 'target' of them
+    std::vector<Subtree> makeSubtrees(const Board& board, int maxDepth, std::size_t target)
+    {
+        std::vector<Subtree> layer{ Subtree{ PackedBoard{ board }, {}, -1 } };
+        for (int depth{ 0 }; depth < maxDepth && layer.size() < target; ++depth)
+        {
+            std::vector<Subtree> next{};
+            for (const auto& subtree : layer)
+            {
+                for (int dir{ 0 }; dir < Direction::max_directions; ++dir)
+                {
+                    Direction move{ static_cast<Direction::Type>(dir) };
+                    if ((-move).getDirection() == subtree.lastDir)
+                        continue;
+
+                    Subtree child{ subtree };
+                    if (!child.board.swapExecuted(move))
+                        continue;
+                    child.prefix.push_back(move);
+                    child.lastDir = dir;
+                    next.push_back(std::move(child));
+                }
+            }
+            layer = std::move(next);
+        }
+        return layer;
+    }
+
+    class Scheduler
+    {
+    private:
+        const PatternDatabase* database;
+        int threads;
+        long long splitNodes;
+        const BatchSolver::ResultCallback& onResult;
+
+        std::vector<std::unique_ptr<Instance>> instances{};
+        TaskPool pool;
+        std::mutex resultMutex{};
+
+        void finish(int index)
+        {
+            Instance& instance{ *instances[index] };
+            std::chrono::duration<double, std::milli> elapsed{ Clock::now() - instance.start };
+
+            BatchSolver::Result result{};
+            result.instance = index;
+            result.length = static_cast<int>(instance.solution.size());
+            result.nodes = instance.nodes.load();
+            result.milliseconds = elapsed.count();
+            result.moves = instance.solution;
+
+            std::lock_guard<std::mutex> lock{ resultMutex };
+            onResult(result);
+        }
+
+        void pushPass(int worker, int index)
+        {
+            Instance& instance{ *instances[index] };
+            instance.nextBound = std::numeric_limits<int>::max();
+            instance.remaining = static_cast<int>(instance.subtrees.size());
+            for (int subtree{ 0 }; subtree < static_cast<int>(instance.subtrees.size()); ++subtree)
+                pool.push(worker, Task{ index, subtree });
+        }
+
+        // Plain IDA* until a pass gets expensive, then hand the rest to the pool
+        void runRoot(int worker, int index)
+        {
+            Instance& instance{ *instances[index] };
+            instance.start = Clock::now();
+
+            Solver solver{ instance.board, database };
+            assert(solver.isSolvable() && "Board cannot be solved.");
+
+            int bound{ solver.getEstimate() };
+            while (true)
+            {
+                long long before{ solver.getNodesExpanded() };
+                int nextBound{ 0 };
+                if (solver.searchPass(0, bound, -1, nextBound))
+                {
+                    instance.nodes = solver.getNodesExpanded();
+                    instance.solution = solver.getPath();
+                    finish(index);
+                    return;
+                }
+
+                if (solver.getNodesExpanded() - before > splitNodes && threads > 1)
+                {
+                    // Every solution is longer than bound, so subtrees no deeper
+                    // than that cannot skip past one
+                    instance.nodes = solver.getNodesExpanded();
+                    instance.subtrees = makeSubtrees(instance.board, bound,
+                                                     static_cast<std::size_t>(threads * subtrees_per_thread));
+                    instance.bound = nextBound;
+                    pushPass(worker, index);
+                    return;
+                }
+                bound = nextBound;
+            }
+        }
+
+        void runSubtree(int worker, int index, int subtreeIndex)
+        {
+            Instance& instance{ *instances[index] };
+            const Subtree& subtree{ instance.subtrees[subtreeIndex] };
+
+            if (!instance.solved)
+            {
+                Solver solver{ subtree.board.toBoard(), database };
+                solver.setStopFlag(&instance.solved);
+
+                int nextBound{ std::numeric_limits<int>::max() };
+                int depth{ static_cast<int>(subtree.prefix.size()) };
+                if (solver.searchPass(depth, instance.bound, subtree.lastDir, nextBound))
+                {
+                    // Any solution found in this pass is optimal; keep the first
+                    std::lock_guard<std::mutex> lock{ instance.solutionMutex };
+                    if (!instance.solved)
+                    {
+                        instance.solution = subtree.prefix;
+                        instance.solution.insert(instance.solution.end(), solver.getPath().begin(), solver.getPath().end());
+                        instance.solved = true;
+                    }
+                }
+                else
+                {
+                    lowerTo(instance.nextBound, nextBound);
+                }
+                instance.nodes += solver.getNodesExpanded();
+            }
+
+            // Last subtree of the pass decides what happens next
+            if (--instance.remaining == 0)
+            {
+                if (instance.solved)
+                {
+                    finish(index);
+                }
+                else
+                {
+                    instance.bound = instance.nextBound;
+                    pushPass(worker, index);
+                }
+            }
+        }
+
+        void work(int worker)
+        {
+            while (pool.hasPending())
+            {
+                Task task{};
+                if (!pool.pop(worker, task))
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                if (task.subtree == root_task)
+                    runRoot(worker, task.instance);
+                else
+                    runSubtree(worker, task.instance, task.subtree);
+                pool.finished();
+            }
+        }
+
+    public:
+        Scheduler(const PatternDatabase* patterns, int threadCount, long long split,
+                  const BatchSolver::ResultCallback& callback)
+            : database{ patterns }
+            , threads{ threadCount }
+            , splitNodes{ split }
+            , onResult{ callback }
+            , pool{ threadCount }
+        {}
+
+        void run(const std::vector<Board>& boards)
+        {
+            for (std::size_t index{ 0 }; index < boards.size(); ++index)
+            {
+                instances.push_back(std::make_unique<Instance>());
+                instances.back()->board = boards[index];
+                pool.push(static_cast<int>(index % threads), Task{ static_cast<int>(index), root_task });
+            }
+
+            std::vector<std::thread> workers{};
+            for (int worker{ 1 }; worker < threads; ++worker)
+                workers.emplace_back(&Scheduler::work, this, worker);
+            work(0);
+
+            for (auto& thread : workers)
+                thread.join();
+        }
+    };
+}
+
+BatchSolver::BatchSolver(int threadCount, const PatternDatabase* patterns)
+    : database{ patterns }
+    , threads{ (threadCount > 0) ? threadCount : 1 }
+{}
+
+void BatchSolver::solve(const std::vector<Board>& boards, const ResultCallback& onResult) const
+{
+    Scheduler scheduler{ database, threads, splitNodes, onResult };
+    scheduler.run(boards);
+}
+
+bool BatchSolver::readBoards(std::istream& in, std::vector<Board>& boards, std::string& error)
+{
+    std::string line{};
+    int lineNumber{ 0 };
+    while (std::getline(in, line))
+    {
+        ++lineNumber;
+        std::istringstream words{ line };
+        std::string first{};
+        if (!(words >> first) || first[0] == '#')
+            continue;
+
+        words.clear();
+        words.str(line);
+
+        Board::TileList tiles{};
+        bool used[PackedBoard::n_cells]{};
+        int count{ 0 };
+        int number{};
+        while (words >> number)
+        {
+            if (count == PackedBoard::n_cells || number < 0 || number >= PackedBoard::n_cells || used[number])
+            {
+                error = "line " + std::to_string(lineNumber) + ": expected each of 0-15 once";
+                return false;
+            }
+            used[number] = true;
+            tiles[count++] = Tile{ number };
+        }
+
+        if (count != PackedBoard::n_cells || !words.eof())
+        {
+            error = "line " + std::to_string(lineNumber) + ": expected 16 numbers";
+            return false;
+        }
+
+        Board board{ tiles };
+        if (!Solver{ board }.isSolvable())
+        {
+            error = "line " + std::to_string(lineNumber) + ": board cannot be solved";
+            return false;
+        }
+        boards.push_back(board);
+    }
+    return true;
+}
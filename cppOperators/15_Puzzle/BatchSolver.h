@@ -0,0 +1,57 @@
+#ifndef BATCH_SOLVER_H
+#define BATCH_SOLVER_H
+
+#include "Board.h"
+#include "Direction.h"
+#include "PatternDatabase.h"
+#include <functional>
+#include <istream>
+#include <string>
+#include <vector>
+
+// Solves many boards at once on all cores.
+//
+// Each worker thread has its own queue of tasks: it takes new work from the
+// back of its own queue and, when that is empty, steals from the front of
+// another worker's. A board starts as one task running IDA* passes on its
+// own. If a pass gets expensive, the search tree is split at a shallow depth
+// and every later pass is spread over the workers as one task per subtree, so
+// a single hard board still keeps every core busy.
+class BatchSolver
+{
+public:
+    struct Result
+    {
+        int instance{};                 // index into the list of boards
+        int length{};                   // optimal number of moves
+        long long nodes{};              // nodes expanded over all passes
+        double milliseconds{};
+        std::vector<Direction> moves{};
+    };
+
+    using ResultCallback = std::function<void(const Result&)>;
+
+    // Pass expanding more nodes than this is split between workers
+    static constexpr long long default_split_nodes{ 200000 };
+
+private:
+    const PatternDatabase* database{ nullptr };
+    int threads{ 1 };
+    long long splitNodes{ default_split_nodes };
+
+public:
+    explicit BatchSolver(int threadCount, const PatternDatabase* patterns = nullptr);
+
+    void setSplitNodes(long long nodes) { splitNodes = nodes; }
+
+    // Solves every board, calling onResult (one call at a time) as each one
+    // finishes, in whatever order they finish. Boards must be solvable.
+    void solve(const std::vector<Board>& boards, const ResultCallback& onResult) const;
+
+    // Reads one board per line (16 tile numbers, 0 for the empty tile).
+    // Blank lines and lines starting with '#' are skipped. Returns false and
+    // sets error on a malformed line.
+    static bool readBoards(std::istream& in, std::vector<Board>& boards, std::string& error);
+};
+
+#endif
@@ -1,36 +1,125 @@
 #ifndef BOARD_H
 #define BOARD_H
 
+#include "BoardTables.h"
 #include "Point.h"
+#include "Renderer.h"
+#include "Scrambler.h"
 #include "Tile.h"
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <utility>
 
-constexpr int g_consoleLines{ 25 };
-
-class Board 
+// Width x Height sliding puzzle (Board below is the classic 4x4 15 puzzle)
+template <int Width, int Height>
+class BasicBoard 
 {
 private:
-    static constexpr int grid_size{ 4 };
-    Tile boardState[grid_size][grid_size]{};
-    static constexpr int rand_moves{ 1000 };
+    static_assert(Width >= 2 && Height >= 2, "Board needs at least 2 rows and 2 columns.");
+
+    static constexpr int n_cells{ Width * Height };
+    Tile boardState[Height][Width]{};
     
 public:
-    Board();
+    BasicBoard()
+    {
+        for (int i{ 0 }; i < n_cells; ++i)
+        {
+            int n = i + 1;
+            int y = i / Width;
+            int x = i % Width;
+            if (n < n_cells)
+                boardState[y][x] = Tile{ n };
+            else
+                boardState[y][x] = Tile{ 0 };
+        }
+    }
+
+    // Tiles listed row by row, top left first
+    using TileList = std::array<Tile, n_cells>;
+    explicit BasicBoard(const TileList& tiles)
+    {
+        for (int i{ 0 }; i < n_cells; ++i)
+        {
+            assert(tiles[i].getNum() < n_cells && "Tile number out-of-bounds.");
+            boardState[i / Width][i % Width] = tiles[i];
+        }
+    }
 
-    static void printEmptyLines(int count);
+    static constexpr int getWidth() { return Width; }
+    static constexpr int getHeight() { return Height; }
 
-    friend std::ostream& operator<<(std::ostream& out, const Board& b1);
+    Tile getTile(Point pt) const { return boardState[pt.y][pt.x]; }
 
-    friend bool operator==(const Board& b1, const Board& b2);
+    // Blank lines then the board, formatted in one go (see Renderer.h)
+    friend std::ostream& operator<<(std::ostream& out, const BasicBoard& b1)
+    {
+        BasicRenderer<Width, Height> renderer{ BasicRenderer<Width, Height>::scroll };
+        std::string_view frame{ renderer.render(b1) };
+        return out.write(frame.data(), static_cast<std::streamsize>(frame.size()));
+    }
 
-    Point getEmptyTileLoc() const;
+    friend bool operator==(const BasicBoard& b1, const BasicBoard& b2)
+    {
+        for (int y{ 0 }; y < Height; ++y)
+        {
+            for (int x{ 0 }; x < Width; ++x)
+            {
+                if (b1.boardState[y][x] != b2.boardState[y][x])
+                    return false;
+            }
+        }
+        return true;
+    }
 
-    static bool isValidSwap(Point pt);
+    Point getEmptyTileLoc() const
+    {
+        for (int y{ 0 }; y < Height; ++y)
+        {
+            for (int x{ 0 }; x < Width; ++x)
+            {
+                if (boardState[y][x].isEmpty())
+                    return { x, y };
+            }
+        }
+        
+        assert(0 && "No empty tile in board.");
+        return { -1, -1 };
+    }
 
-    void swapTiles(Point p1, Point p2);
+    static bool isValidSwap(Point pt)
+    {
+        return (pt.x >= 0 && pt.x < Width && pt.y >= 0 && pt.y < Height);
+    }
 
-    bool swapExecuted(Direction dir);
+    void swapTiles(Point p1, Point p2)
+    {
+        std::swap(boardState[p1.y][p1.x], boardState[p2.y][p2.x]);
+    }
 
-    void randomise();
+    bool swapExecuted(Direction dir)
+    {
+        Point emptyTile{ getEmptyTileLoc() };
+        int from{ BoardTables::neighbours<Width, Height>[emptyTile.y * Width + emptyTile.x][dir.getDirection()] };
+
+        if (from != BoardTables::no_cell)
+        {
+            swapTiles(emptyTile, Point{ from % Width, from / Width });
+            return true;
+        }
+        return false;
+    }
+
+    // Uniformly random solvable board, see Scrambler.h
+    void randomise()
+    {
+        TileList tiles{};
+        Scrambler::scramble<Width, Height>(tiles, Random::getGenerator());
+        *this = BasicBoard{ tiles };
+    }
 };
 
+using Board = BasicBoard<4, 4>;
+
 #endif
@@ -0,0 +1,116 @@
+#ifndef BOARD_TABLES_H
+#define BOARD_TABLES_H
+
+#include "Direction.h"
+#include <array>
+#include <utility>
+
+// Lookup tables for a Width x Height board, built at compile time.
+// Cells are numbered row by row from the top left (cell = y * Width + x).
+namespace BoardTables
+{
+    constexpr int no_cell{ -1 };
+
+    // Cell the tile should end up in (empty tile goes bottom right)
+    template <int Width, int Height>
+    constexpr int goalCell(int tile)
+    {
+        return (tile == 0) ? Width * Height - 1 : tile - 1;
+    }
+
+    template <int Width, int Height>
+    constexpr auto makeNeighbours()
+    {
+        std::array<std::array<int, Direction::max_directions>, Width * Height> table{};
+        for (int cell{ 0 }; cell < Width * Height; ++cell)
+        {
+            int x{ cell % Width };
+            int y{ cell / Width };
+            table[cell][Direction::up] = (y > 0) ? cell - Width : no_cell;
+            table[cell][Direction::down] = (y < Height - 1) ? cell + Width : no_cell;
+            table[cell][Direction::left] = (x > 0) ? cell - 1 : no_cell;
+            table[cell][Direction::right] = (x < Width - 1) ? cell + 1 : no_cell;
+        }
+        return table;
+    }
+
+    template <int Width, int Height>
+    constexpr auto makeLegalMoves()
+    {
+        constexpr auto table{ makeNeighbours<Width, Height>() };
+        std::array<unsigned int, Width * Height> moves{};
+        for (int cell{ 0 }; cell < Width * Height; ++cell)
+        {
+            for (int dir{ 0 }; dir < Direction::max_directions; ++dir)
+            {
+                if (table[cell][dir] != no_cell)
+                    moves[cell] |= 1u << dir;
+            }
+        }
+        return moves;
+    }
+
+    template <int Width, int Height>
+    constexpr auto makeManhattan()
+    {
+        std::array<std::array<int, Width * Height>, Width * Height> table{};
+        for (int tile{ 1 }; tile < Width * Height; ++tile)
+        {
+            int goal{ goalCell<Width, Height>(tile) };
+            for (int cell{ 0 }; cell < Width * Height; ++cell)
+            {
+                int dx{ goal % Width - cell % Width };
+                int dy{ goal / Width - cell / Width };
+                table[tile][cell] = (dx < 0 ? -dx : dx) + (dy < 0 ? -dy : dy);
+            }
+        }
+        return table;
+    }
+
+    // neighbours[cell][dir]: cell the empty tile moves to, or no_cell if off the board
+    template <int Width, int Height>
+    inline constexpr auto neighbours{ makeNeighbours<Width, Height>() };
+
+    // legalMoves[cell]: bit (1 << dir) set for each direction the empty tile can move
+    template <int Width, int Height>
+    inline constexpr auto legalMoves{ makeLegalMoves<Width, Height>() };
+
+    // manhattan[tile][cell]: moves tile needs to reach its goal from cell (0 for the empty tile)
+    template <int Width, int Height>
+    inline constexpr auto manhattan{ makeManhattan<Width, Height>() };
+
+    // Only half of all tile arrangements can reach the completed board. Each
+    // move swaps the empty tile with a neighbour, flipping both the permutation
+    // parity and the parity of the empty tile's distance from its goal cell, so
+    // the two must match. tileAt(cell) gives the tile number in each cell.
+    template <int Width, int Height, typename TileAt>
+    bool isSolvable(TileAt tileAt)
+    {
+        constexpr int n_cells{ Width * Height };
+        int perm[n_cells]{};
+        int emptyCell{ 0 };
+        for (int cell{ 0 }; cell < n_cells; ++cell)
+        {
+            int tile{ tileAt(cell) };
+            perm[cell] = goalCell<Width, Height>(tile);
+            if (tile == 0)
+                emptyCell = cell;
+        }
+
+        // Parity from cycle lengths: a cycle of length k takes k - 1 swaps
+        int swaps{ 0 };
+        for (int cell{ 0 }; cell < n_cells; ++cell)
+        {
+            while (perm[cell] != cell)
+            {
+                std::swap(perm[cell], perm[perm[cell]]);
+                ++swaps;
+            }
+        }
+
+        int emptyDistance{ (Width - 1 - emptyCell % Width) + (Height - 1 - emptyCell / Width) };
+        return (swaps % 2) == (emptyDistance % 2);
+    }
+}
+
+#endif
@@ -1,5 +1,5 @@
 #include "Direction.h"
-#include "Random_MT.h"
+#include "../../cppCommon/Random.h"
 #include <cassert>
 #include <iostream>
 
@@ -32,6 +32,6 @@ std::ostream& operator<<(std::ostream& out, const Direction& d1)
 
 Direction Direction::getRandomDirection()
 {
-    Type random{ static_cast<Type>(RandomMT::getRandomInt(0, max_directions - 1)) };
+    Type random{ static_cast<Type>(Random::get(0, max_directions - 1)) };
     return Direction{ random };
 }
@@ -0,0 +1,229 @@
+#include "Heuristic.h"
+#include <immintrin.h>
+
+namespace
+{
+    static_assert(PackedBoard::bits_per_tile == 4 && PackedBoard::n_cells == 16,
+                  "Kernels expect the 15 puzzle packed 4 bits per tile.");
+
+    const auto& conflictTable{ SolverTables::conflictTable<4> };
+
+    // Indexed by tile (the empty tile is masked out)
+    alignas(16) constexpr std::int8_t goal_rows[16]{ 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3 };
+    alignas(16) constexpr std::int8_t goal_cols[16]{ 0, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2 };
+
+    // Indexed by cell
+    alignas(16) constexpr std::int8_t cell_rows[16]{ 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3 };
+    alignas(16) constexpr std::int8_t cell_cols[16]{ 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3 };
+
+    // Weight of each position in a line code (base 5, see SolverTables)
+    alignas(16) constexpr std::int8_t line_weights[16]{ 1, 5, 25, 125, 1, 5, 25, 125, 1, 5, 25, 125, 1, 5, 25, 125 };
+
+    // Cells column by column, so columns can be coded like rows
+    alignas(16) constexpr std::int8_t transpose[16]{ 0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15 };
+
+    int scalarEstimate(PackedBoard::State state)
+    {
+        return Heuristic::evaluate(PackedBoard{ state }).total();
+    }
+
+    // One byte per cell holding its tile number
+    __attribute__((target("sse4.1")))
+    __m128i unpackTiles(PackedBoard::State state)
+    {
+        __m128i packed{ _mm_cvtsi64_si128(static_cast<long long>(state)) };
+        __m128i nibbles{ _mm_set1_epi8(0x0F) };
+        __m128i low{ _mm_and_si128(packed, nibbles) };
+        __m128i high{ _mm_and_si128(_mm_srli_epi16(packed, 4), nibbles) };
+        return _mm_unpacklo_epi8(low, high);
+    }
+
+    // Manhattan distance (in the low 16 bits of both halves) and the four
+    // row and column codes
+    struct Parts
+    {
+        __m128i distances{};
+        __m128i rowCodes{};
+        __m128i colCodes{};
+    };
+
+    __attribute__((target("sse4.1")))
+    Parts getParts(PackedBoard::State state)
+    {
+        __m128i tiles{ unpackTiles(state) };
+        __m128i goalRows{ _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(goal_rows)), tiles) };
+        __m128i goalCols{ _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(goal_cols)), tiles) };
+        __m128i cellRows{ _mm_load_si128(reinterpret_cast<const __m128i*>(cell_rows)) };
+        __m128i cellCols{ _mm_load_si128(reinterpret_cast<const __m128i*>(cell_cols)) };
+        __m128i present{ _mm_cmpgt_epi8(tiles, _mm_setzero_si128()) };
+        __m128i one{ _mm_set1_epi8(1) };
+
+        __m128i distance{ _mm_add_epi8(_mm_abs_epi8(_mm_sub_epi8(goalRows, cellRows)),
+                                       _mm_abs_epi8(_mm_sub_epi8(goalCols, cellCols))) };
+
+        // Tiles in their goal row give their goal column + 1 to the row code, and so on
+        __m128i inRow{ _mm_and_si128(_mm_cmpeq_epi8(goalRows, cellRows), present) };
+        __m128i inCol{ _mm_and_si128(_mm_cmpeq_epi8(goalCols, cellCols), present) };
+        __m128i rowDigits{ _mm_and_si128(inRow, _mm_add_epi8(goalCols, one)) };
+        __m128i colDigits{ _mm_shuffle_epi8(_mm_and_si128(inCol, _mm_add_epi8(goalRows, one)),
+                                            _mm_load_si128(reinterpret_cast<const __m128i*>(transpose))) };
+
+        __m128i weights{ _mm_load_si128(reinterpret_cast<const __m128i*>(line_weights)) };
+        __m128i ones{ _mm_set1_epi16(1) };
+
+        Parts parts{};
+        parts.distances = _mm_sad_epu8(_mm_and_si128(distance, present), _mm_setzero_si128());
+        parts.rowCodes = _mm_madd_epi16(_mm_maddubs_epi16(rowDigits, weights), ones);
+        parts.colCodes = _mm_madd_epi16(_mm_maddubs_epi16(colDigits, weights), ones);
+        return parts;
+    }
+
+    __attribute__((target("sse4.1")))
+    int sseManhattan(PackedBoard::State state)
+    {
+        __m128i distances{ getParts(state).distances };
+        return _mm_cvtsi128_si32(distances) + _mm_extract_epi16(distances, 4);
+    }
+
+    __attribute__((target("sse4.1")))
+    int sseConflicts(PackedBoard::State state)
+    {
+        Parts parts{ getParts(state) };
+        return conflictTable[_mm_extract_epi32(parts.rowCodes, 0)] + conflictTable[_mm_extract_epi32(parts.rowCodes, 1)]
+             + conflictTable[_mm_extract_epi32(parts.rowCodes, 2)] + conflictTable[_mm_extract_epi32(parts.rowCodes, 3)]
+             + conflictTable[_mm_extract_epi32(parts.colCodes, 0)] + conflictTable[_mm_extract_epi32(parts.colCodes, 1)]
+             + conflictTable[_mm_extract_epi32(parts.colCodes, 2)] + conflictTable[_mm_extract_epi32(parts.colCodes, 3)];
+    }
+
+    __attribute__((target("sse4.1")))
+    int sseEstimate(PackedBoard::State state)
+    {
+        Parts parts{ getParts(state) };
+        int manhattan{ _mm_cvtsi128_si32(parts.distances) + _mm_extract_epi16(parts.distances, 4) };
+        return manhattan
+             + conflictTable[_mm_extract_epi32(parts.rowCodes, 0)] + conflictTable[_mm_extract_epi32(parts.rowCodes, 1)]
+             + conflictTable[_mm_extract_epi32(parts.rowCodes, 2)] + conflictTable[_mm_extract_epi32(parts.rowCodes, 3)]
+             + conflictTable[_mm_extract_epi32(parts.colCodes, 0)] + conflictTable[_mm_extract_epi32(parts.colCodes, 1)]
+             + conflictTable[_mm_extract_epi32(parts.colCodes, 2)] + conflictTable[_mm_extract_epi32(parts.colCodes, 3)];
+    }
+
+    __attribute__((target("avx2")))
+    __m256i broadcast(const std::int8_t* table)
+    {
+        return _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(table)));
+    }
+
+    // Two boards per register, one in each 128-bit lane; the same steps as getParts()
+    __attribute__((target("avx2")))
+    void avx2EstimatePair(PackedBoard::State first, PackedBoard::State second, int* estimates)
+    {
+        __m128i packed{ _mm_set_epi64x(static_cast<long long>(second), static_cast<long long>(first)) };
+        __m128i nibbles{ _mm_set1_epi8(0x0F) };
+        __m128i low{ _mm_and_si128(packed, nibbles) };
+        __m128i high{ _mm_and_si128(_mm_srli_epi16(packed, 4), nibbles) };
+        __m256i tiles{ _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi8(low, high)),
+                                               _mm_unpackhi_epi8(low, high), 1) };
+
+        __m256i goalRows{ _mm256_shuffle_epi8(broadcast(goal_rows), tiles) };
+        __m256i goalCols{ _mm256_shuffle_epi8(broadcast(goal_cols), tiles) };
+        __m256i cellRows{ broadcast(cell_rows) };
+        __m256i cellCols{ broadcast(cell_cols) };
+        __m256i present{ _mm256_cmpgt_epi8(tiles, _mm256_setzero_si256()) };
+        __m256i one{ _mm256_set1_epi8(1) };
+
+        __m256i distance{ _mm256_add_epi8(_mm256_abs_epi8(_mm256_sub_epi8(goalRows, cellRows)),
+                                          _mm256_abs_epi8(_mm256_sub_epi8(goalCols, cellCols))) };
+        __m256i distances{ _mm256_sad_epu8(_mm256_and_si256(distance, present), _mm256_setzero_si256()) };
+
+        __m256i inRow{ _mm256_and_si256(_mm256_cmpeq_epi8(goalRows, cellRows), present) };
+        __m256i inCol{ _mm256_and_si256(_mm256_cmpeq_epi8(goalCols, cellCols), present) };
+        __m256i rowDigits{ _mm256_and_si256(inRow, _mm256_add_epi8(goalCols, one)) };
+        __m256i colDigits{ _mm256_shuffle_epi8(_mm256_and_si256(inCol, _mm256_add_epi8(goalRows, one)),
+                                               broadcast(transpose)) };
+
+        __m256i weights{ broadcast(line_weights) };
+        __m256i ones{ _mm256_set1_epi16(1) };
+        __m256i rowCodes{ _mm256_madd_epi16(_mm256_maddubs_epi16(rowDigits, weights), ones) };
+        __m256i colCodes{ _mm256_madd_epi16(_mm256_maddubs_epi16(colDigits, weights), ones) };
+
+        // Eight conflict lookups at once for each of rows and columns
+        __m256i conflicts{ _mm256_add_epi32(_mm256_i32gather_epi32(conflictTable.data(), rowCodes, 4),
+                                            _mm256_i32gather_epi32(conflictTable.data(), colCodes, 4)) };
+        conflicts = _mm256_hadd_epi32(conflicts, conflicts);
+        conflicts = _mm256_hadd_epi32(conflicts, conflicts);
+
+        // Per lane: Manhattan halves in 64-bit words 0 and 1, conflicts in word 0
+        __m256i totals{ _mm256_add_epi32(_mm256_add_epi32(distances, _mm256_srli_si256(distances, 8)), conflicts) };
+        estimates[0] = _mm256_extract_epi32(totals, 0);
+        estimates[1] = _mm256_extract_epi32(totals, 4);
+    }
+
+    __attribute__((target("avx2")))
+    void avx2Estimates(const PackedBoard::State* states, int* estimates, std::size_t count)
+    {
+        std::size_t index{ 0 };
+        for (; index + 2 <= count; index += 2)
+            avx2EstimatePair(states[index], states[index + 1], estimates + index);
+        if (index < count)
+            estimates[index] = sseEstimate(states[index]);
+    }
+}
+
+namespace Heuristic
+{
+    Kernel getKernel()
+    {
+        static const Kernel best{ __builtin_cpu_supports("avx2") ? Kernel::avx2
+                                : __builtin_cpu_supports("sse4.1") ? Kernel::sse41
+                                : Kernel::scalar };
+        return best;
+    }
+
+    int getManhattan(PackedBoard::State state)
+    {
+        if (getKernel() != Kernel::scalar)
+            return sseManhattan(state);
+        return evaluate(PackedBoard{ state }).manhattan;
+    }
+
+    int getLinearConflicts(PackedBoard::State state)
+    {
+        if (getKernel() != Kernel::scalar)
+            return sseConflicts(state);
+        return evaluate(PackedBoard{ state }).conflicts;
+    }
+
+    int getEstimate(PackedBoard::State state)
+    {
+        if (getKernel() != Kernel::scalar)
+            return sseEstimate(state);
+        return scalarEstimate(state);
+    }
+
+    void getEstimates(const PackedBoard::State* states, int* estimates, std::size_t count)
+    {
+        getEstimates(states, estimates, count, getKernel());
+    }
+
+    void getEstimates(const PackedBoard::State* states, int* estimates, std::size_t count, Kernel kernel)
+    {
+        // Never use a kernel the CPU does not have
+        if (static_cast<int>(kernel) > static_cast<int>(getKernel()))
+            kernel = getKernel();
+
+        switch (kernel)
+        {
+            case Kernel::avx2:
+                avx2Estimates(states, estimates, count);
+                break;
+            case Kernel::sse41:
+                for (std::size_t index{ 0 }; index < count; ++index)
+                    estimates[index] = sseEstimate(states[index]);
+                break;
+            default:
+                for (std::size_t index{ 0 }; index < count; ++index)
+                    estimates[index] = scalarEstimate(states[index]);
+                break;
+        }
+    }
+}
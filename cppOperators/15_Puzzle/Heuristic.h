@@ -0,0 +1,231 @@
+#ifndef HEURISTIC_H
+#define HEURISTIC_H
+
+#include "BoardTables.h"
+#include "PackedBoard.h"
+#include <array>
+#include <cstddef>
+
+namespace SolverTables
+{
+    constexpr int power(int base, int exp)
+    {
+        int result{ 1 };
+        for (int i{ 0 }; i < exp; ++i)
+            result *= base;
+        return result;
+    }
+
+    // A line (row or column) of the board is encoded in base (length + 1), one
+    // digit per cell: 0 if the tile does not belong in this line, otherwise its
+    // goal position + 1. Conflict cost is 2 moves for every tile that must leave
+    // the line so the remaining ones are in increasing order (i.e. tiles in the
+    // line - longest increasing run).
+    constexpr int getLineConflicts(int code, int length)
+    {
+        int goals[16]{};
+        int count{ 0 };
+        for (int i{ 0 }; i < length; ++i)
+        {
+            int digit{ code % (length + 1) };
+            code /= (length + 1);
+            if (digit)
+                goals[count++] = digit;
+        }
+
+        int longest[16]{};
+        int best{ 0 };
+        for (int i{ 0 }; i < count; ++i)
+        {
+            longest[i] = 1;
+            for (int j{ 0 }; j < i; ++j)
+            {
+                if (goals[j] < goals[i] && longest[j] + 1 > longest[i])
+                    longest[i] = longest[j] + 1;
+            }
+            if (longest[i] > best)
+                best = longest[i];
+        }
+        return 2 * (count - best);
+    }
+
+    // Lines up to 5 cells long look their conflicts up in a table of every code
+    template <int Length>
+    inline constexpr bool uses_conflict_table{ Length <= 5 };
+
+    template <int Length>
+    constexpr auto makeConflictTable()
+    {
+        std::array<int, power(Length + 1, Length)> table{};
+        for (int code{ 0 }; code < power(Length + 1, Length); ++code)
+            table[code] = getLineConflicts(code, Length);
+        return table;
+    }
+
+    template <int Length>
+    inline constexpr auto conflictTable{ makeConflictTable<Length>() };
+
+    template <int Length>
+    int lookupConflicts(int code)
+    {
+        if constexpr (uses_conflict_table<Length>)
+            return conflictTable<Length>[code];
+        else
+            return getLineConflicts(code, Length);
+    }
+
+    // weight[tile][cell]: tile's contribution to the code of the row (or column)
+    // holding cell
+    template <int Width, int Height, bool Rows>
+    constexpr auto makeWeightTable()
+    {
+        constexpr int n_cells{ Width * Height };
+        std::array<std::array<int, n_cells>, n_cells> table{};
+        for (int tile{ 1 }; tile < n_cells; ++tile)
+        {
+            int goal{ BoardTables::goalCell<Width, Height>(tile) };
+            for (int cell{ 0 }; cell < n_cells; ++cell)
+            {
+                int line{ Rows ? cell / Width : cell % Width };
+                int position{ Rows ? cell % Width : cell / Width };
+                int goalLine{ Rows ? goal / Width : goal % Width };
+                int goalPosition{ Rows ? goal % Width : goal / Width };
+                int base{ (Rows ? Width : Height) + 1 };
+                if (line == goalLine)
+                    table[tile][cell] = (goalPosition + 1) * power(base, position);
+            }
+        }
+        return table;
+    }
+
+    template <int Width, int Height>
+    inline constexpr auto rowWeight{ makeWeightTable<Width, Height, true>() };
+
+    template <int Width, int Height>
+    inline constexpr auto colWeight{ makeWeightTable<Width, Height, false>() };
+}
+
+// Solver's estimate (Manhattan distance + linear conflict): a full
+// evaluation of a board, and the O(1) update for a single move that the
+// solver applies at every step of its search.
+//
+// For the 15 puzzle there are also SIMD kernels working straight on the
+// packed nibbles of a PackedBoard: SSE4.1 for one board, AVX2 for batches
+// (two boards per register, conflict lookups gathered 8 at a time). They
+// are picked at run time, so no special compiler flags are needed, and fall
+// back to the scalar code on older CPUs.
+namespace Heuristic
+{
+    // Manhattan distance, linear conflicts and the row/column codes the
+    // conflicts are looked up from (see SolverTables)
+    template <int Width, int Height>
+    struct Estimate
+    {
+        int manhattan{ 0 };
+        int conflicts{ 0 };
+        int rowCodes[Height]{};
+        int colCodes[Width]{};
+
+        int total() const { return manhattan + conflicts; }
+    };
+
+    // One tile at a time; the reference for the kernels below
+    template <int Width, int Height>
+    Estimate<Width, Height> evaluate(const BasicPackedBoard<Width, Height>& board)
+    {
+        Estimate<Width, Height> estimate{};
+        for (int cell{ 0 }; cell < Width * Height; ++cell)
+        {
+            int tile{ board.getTile(cell) };
+            estimate.manhattan += BoardTables::manhattan<Width, Height>[tile][cell];
+            estimate.rowCodes[cell / Width] += SolverTables::rowWeight<Width, Height>[tile][cell];
+            estimate.colCodes[cell % Width] += SolverTables::colWeight<Width, Height>[tile][cell];
+        }
+
+        for (int row{ 0 }; row < Height; ++row)
+            estimate.conflicts += SolverTables::lookupConflicts<Width>(estimate.rowCodes[row]);
+        for (int col{ 0 }; col < Width; ++col)
+            estimate.conflicts += SolverTables::lookupConflicts<Height>(estimate.colCodes[col]);
+        return estimate;
+    }
+
+    // Change in Manhattan distance when 'tile' slides from cell 'from' to 'to'
+    template <int Width, int Height>
+    int getManhattanDelta(int tile, int from, int to)
+    {
+        return BoardTables::manhattan<Width, Height>[tile][to] - BoardTables::manhattan<Width, Height>[tile][from];
+    }
+
+    // Updates the estimate for 'tile' sliding from 'from' into the empty
+    // cell 'to' and returns the change in total. Only the two lines the tile
+    // moves between can change their conflicts; the line it moves along
+    // keeps its order but changes its code.
+    template <int Width, int Height>
+    int applyMove(Estimate<Width, Height>& estimate, int tile, int from, int to)
+    {
+        const auto& rowWeight{ SolverTables::rowWeight<Width, Height> };
+        const auto& colWeight{ SolverTables::colWeight<Width, Height> };
+
+        int oldTotal{ estimate.total() };
+        estimate.manhattan += getManhattanDelta<Width, Height>(tile, from, to);
+
+        bool vertical{ from % Width == to % Width };
+        if (vertical)
+        {
+            int rowTo{ to / Width };
+            int rowFrom{ from / Width };
+            int oldTo{ estimate.rowCodes[rowTo] };
+            int oldFrom{ estimate.rowCodes[rowFrom] };
+            estimate.rowCodes[rowTo] += rowWeight[tile][to];
+            estimate.rowCodes[rowFrom] -= rowWeight[tile][from];
+            estimate.colCodes[from % Width] += colWeight[tile][to] - colWeight[tile][from];
+            estimate.conflicts += SolverTables::lookupConflicts<Width>(estimate.rowCodes[rowTo])
+                                + SolverTables::lookupConflicts<Width>(estimate.rowCodes[rowFrom])
+                                - SolverTables::lookupConflicts<Width>(oldTo)
+                                - SolverTables::lookupConflicts<Width>(oldFrom);
+        }
+        else
+        {
+            int colTo{ to % Width };
+            int colFrom{ from % Width };
+            int oldTo{ estimate.colCodes[colTo] };
+            int oldFrom{ estimate.colCodes[colFrom] };
+            estimate.colCodes[colTo] += colWeight[tile][to];
+            estimate.colCodes[colFrom] -= colWeight[tile][from];
+            estimate.rowCodes[from / Width] += rowWeight[tile][to] - rowWeight[tile][from];
+            estimate.conflicts += SolverTables::lookupConflicts<Height>(estimate.colCodes[colTo])
+                                + SolverTables::lookupConflicts<Height>(estimate.colCodes[colFrom])
+                                - SolverTables::lookupConflicts<Height>(oldTo)
+                                - SolverTables::lookupConflicts<Height>(oldFrom);
+        }
+
+        return estimate.total() - oldTotal;
+    }
+
+    // 15 puzzle kernels on a PackedBoard state word
+
+    enum class Kernel
+    {
+        scalar,
+        sse41,
+        avx2,
+    };
+
+    // Best kernel this CPU supports
+    Kernel getKernel();
+
+    int getManhattan(PackedBoard::State state);
+    int getLinearConflicts(PackedBoard::State state);
+
+    // Manhattan distance + linear conflict, the same as Solver::getEstimate()
+    // without a pattern database
+    int getEstimate(PackedBoard::State state);
+
+    // getEstimate() for 'count' boards
+    void getEstimates(const PackedBoard::State* states, int* estimates, std::size_t count);
+
+    // Same with a chosen kernel (falls back to scalar if the CPU lacks it)
+    void getEstimates(const PackedBoard::State* states, int* estimates, std::size_t count, Kernel kernel);
+}
+
+#endif
@@ -0,0 +1,175 @@
+#include "MoveLog.h"
+#include <cstring>
+
+namespace
+{
+    void writeLittleEndian(std::ostream& out, std::uint64_t value, int bytes)
+    {
+        char buffer[8]{};
+        for (int i{ 0 }; i < bytes; ++i)
+            buffer[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+        out.write(buffer, bytes);
+    }
+
+    std::uint64_t readLittleEndian(const std::uint8_t* data, int bytes)
+    {
+        std::uint64_t value{ 0 };
+        for (int i{ 0 }; i < bytes; ++i)
+            value |= static_cast<std::uint64_t>(data[i]) << (8 * i);
+        return value;
+    }
+
+    // Starting state must hold each tile number once
+    bool isValidState(PackedBoard::State state)
+    {
+        unsigned int seen{ 0 };
+        for (int cell{ 0 }; cell < PackedBoard::n_cells; ++cell)
+            seen |= 1u << ((state >> (PackedBoard::bits_per_tile * cell)) & 0xF);
+        return seen == (1u << PackedBoard::n_cells) - 1;
+    }
+}
+
+MoveLog::MoveLog(const Board& board)
+    : start{ board }
+{}
+
+void MoveLog::record(Direction dir)
+{
+    if (moveCount % moves_per_byte == 0)
+        moves.push_back(0);
+    moves.back() |= static_cast<std::uint8_t>(dir.getDirection() << ((moveCount % moves_per_byte) * 2));
+    ++moveCount;
+}
+
+bool MoveLog::replay(Board& board) const
+{
+    board = start.toBoard();
+    for (std::size_t index{ 0 }; index < moveCount; ++index)
+    {
+        if (!board.swapExecuted(getMove(index)))
+            return false;
+    }
+    return true;
+}
+
+void MoveLog::writeHeader(std::ostream& out)
+{
+    out.write(magic, sizeof(magic));
+    const char rest[4]{ static_cast<char>(version), static_cast<char>(Board::getWidth()),
+                        static_cast<char>(Board::getHeight()), 0 };
+    out.write(rest, sizeof(rest));
+}
+
+void MoveLog::write(std::ostream& out) const
+{
+    writeLittleEndian(out, start.getState(), 8);
+    writeLittleEndian(out, moveCount, 4);
+    out.write(reinterpret_cast<const char*>(moves.data()), static_cast<std::streamsize>(moves.size()));
+}
+
+bool MoveLog::readHeader(std::istream& in, std::string& error)
+{
+    char header[header_size]{};
+    if (!in.read(header, header_size) || std::memcmp(header, magic, sizeof(magic)) != 0)
+    {
+        error = "not a move log";
+        return false;
+    }
+    if (static_cast<std::uint8_t>(header[4]) != version || header[5] != Board::getWidth()
+        || header[6] != Board::getHeight())
+    {
+        error = "unsupported move log version or board size";
+        return false;
+    }
+    return true;
+}
+
+bool MoveLog::read(std::istream& in, std::string& error)
+{
+    std::uint8_t header[game_header_size]{};
+    in.read(reinterpret_cast<char*>(header), game_header_size);
+    if (in.gcount() == 0)
+        return false;
+    if (in.gcount() != game_header_size)
+    {
+        error = "log ends inside a game";
+        return false;
+    }
+
+    PackedBoard::State state{ readLittleEndian(header, 8) };
+    if (!isValidState(state))
+    {
+        error = "invalid starting board";
+        return false;
+    }
+
+    start = PackedBoard{ state };
+    moveCount = readLittleEndian(header + 8, 4);
+    moves.resize((moveCount + moves_per_byte - 1) / moves_per_byte);
+    if (!in.read(reinterpret_cast<char*>(moves.data()), static_cast<std::streamsize>(moves.size())))
+    {
+        error = "log ends inside a game";
+        return false;
+    }
+    return true;
+}
+
+bool MoveLog::verify(const std::uint8_t* data, std::size_t size, Summary& summary, std::string& error)
+{
+    if (size < static_cast<std::size_t>(header_size) || std::memcmp(data, magic, sizeof(magic)) != 0)
+    {
+        error = "not a move log";
+        return false;
+    }
+    if (data[4] != version || data[5] != Board::getWidth() || data[6] != Board::getHeight())
+    {
+        error = "unsupported move log version or board size";
+        return false;
+    }
+
+    std::size_t offset{ header_size };
+    while (offset < size)
+    {
+        if (size - offset < static_cast<std::size_t>(game_header_size))
+        {
+            error = "log ends inside game " + std::to_string(summary.games);
+            return false;
+        }
+
+        PackedBoard::State state{ readLittleEndian(data + offset, 8) };
+        std::size_t count{ readLittleEndian(data + offset + 8, 4) };
+        std::size_t bytes{ (count + moves_per_byte - 1) / moves_per_byte };
+        offset += game_header_size;
+
+        if (!isValidState(state))
+        {
+            error = "invalid starting board in game " + std::to_string(summary.games);
+            return false;
+        }
+        if (size - offset < bytes)
+        {
+            error = "log ends inside game " + std::to_string(summary.games);
+            return false;
+        }
+
+        PackedBoard board{ state };
+        bool legal{ true };
+        const std::uint8_t* moveBytes{ data + offset };
+        for (std::size_t index{ 0 }; index < count && legal; ++index)
+        {
+            int code{ (moveBytes[index / moves_per_byte] >> ((index % moves_per_byte) * 2)) & 3 };
+            legal = board.swapExecuted(Direction{ static_cast<Direction::Type>(code) });
+        }
+        offset += bytes;
+
+        ++summary.games;
+        summary.moves += static_cast<long long>(count);
+        if (!legal)
+            ++summary.illegal;
+        else if (board.isComplete())
+            ++summary.solved;
+        else
+            ++summary.unsolved;
+    }
+    return true;
+}
@@ -0,0 +1,82 @@
+#ifndef MOVE_LOG_H
+#define MOVE_LOG_H
+
+#include "Board.h"
+#include "Direction.h"
+#include "PackedBoard.h"
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Compact binary record of one game: the starting board, packed 4 bits per
+// tile, then every move as a 2-bit Direction code, four moves per byte.
+//
+// A log file is an 8-byte header ("15PL", version, width, height, 0)
+// followed by any number of games, each stored as
+//   8 bytes   starting PackedBoard state (little-endian)
+//   4 bytes   number of moves (little-endian)
+//   n/4 bytes moves, first move in the lowest two bits
+// so a 50-move game takes 25 bytes.
+class MoveLog
+{
+public:
+    static constexpr char magic[4]{ '1', '5', 'P', 'L' };
+    static constexpr std::uint8_t version{ 1 };
+    static constexpr int header_size{ 8 };
+    static constexpr int game_header_size{ 12 };
+    static constexpr int moves_per_byte{ 4 };
+
+    // Totals from checking every game in a log
+    struct Summary
+    {
+        long long games{ 0 };
+        long long moves{ 0 };
+        long long solved{ 0 };      // every move legal and the board completed
+        long long unsolved{ 0 };    // every move legal but not completed (player quit)
+        long long illegal{ 0 };     // a move slides no tile: the log is corrupt
+    };
+
+private:
+    PackedBoard start{};
+    std::vector<std::uint8_t> moves{};
+    std::size_t moveCount{ 0 };
+
+public:
+    MoveLog() = default;
+    explicit MoveLog(const Board& board);
+
+    const PackedBoard& getStart() const { return start; }
+    std::size_t size() const { return moveCount; }
+
+    Direction getMove(std::size_t index) const
+    {
+        int shift{ static_cast<int>(index % moves_per_byte) * 2 };
+        return Direction{ static_cast<Direction::Type>((moves[index / moves_per_byte] >> shift) & 3) };
+    }
+
+    // Call for each move that was made (swapExecuted returned true)
+    void record(Direction dir);
+
+    // Plays the moves through Board::swapExecuted from the starting board.
+    // Returns false if a move slides no tile.
+    bool replay(Board& board) const;
+
+    static void writeHeader(std::ostream& out);
+    void write(std::ostream& out) const;
+
+    static bool readHeader(std::istream& in, std::string& error);
+
+    // Reads the next game. Returns false at the end of the log, with error
+    // set if the log is malformed.
+    bool read(std::istream& in, std::string& error);
+
+    // Checks every game of a whole log held in memory (header included)
+    // with PackedBoard moves, without allocating. Returns false and sets
+    // error if the log is malformed.
+    static bool verify(const std::uint8_t* data, std::size_t size, Summary& summary, std::string& error);
+};
+
+#endif
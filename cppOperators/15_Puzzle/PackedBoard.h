@@ -0,0 +1,149 @@
+#ifndef PACKED_BOARD_H
+#define PACKED_BOARD_H
+
+#include "Board.h"
+#include "BoardTables.h"
+#include "Direction.h"
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+
+namespace PackedTables
+{
+    __extension__ typedef unsigned __int128 UInt128;
+
+    // Fewest bits that can hold every tile number 0..(n_cells - 1)
+    constexpr int getBitsPerTile(int n_cells)
+    {
+        int bits{ 1 };
+        while ((1 << bits) < n_cells)
+            ++bits;
+        return bits;
+    }
+
+    inline int countTrailingZeros(std::uint64_t word)
+    {
+        return __builtin_ctzll(word);
+    }
+
+    inline int countTrailingZeros(UInt128 word)
+    {
+        std::uint64_t low{ static_cast<std::uint64_t>(word) };
+        return low ? __builtin_ctzll(low) : 64 + __builtin_ctzll(static_cast<std::uint64_t>(word >> 64));
+    }
+}
+
+// Compact copy of a Board: a few bits per tile in one word (cell 0, the top
+// left, in the lowest bits) plus the cached position of the empty tile.
+// Moves are a table lookup and two shifts, no scanning of the board.
+// The 15 puzzle takes 4 bits per tile in a uint64_t; boards up to 5x5 use
+// 5 bits per tile in a 128-bit word.
+template <int Width, int Height>
+class BasicPackedBoard
+{
+public:
+    static constexpr int n_cells{ Width * Height };
+    static constexpr int bits_per_tile{ PackedTables::getBitsPerTile(n_cells) };
+    static constexpr int no_cell{ BoardTables::no_cell };
+
+    static_assert(n_cells * bits_per_tile <= 128, "Board too large to pack.");
+
+    using State = std::conditional_t<(n_cells * bits_per_tile <= 64), std::uint64_t, PackedTables::UInt128>;
+
+private:
+    static constexpr State tile_mask{ (State{ 1 } << bits_per_tile) - 1 };
+
+    static constexpr State makeCompleteState()
+    {
+        State complete{ 0 };
+        for (int cell{ 0 }; cell < n_cells - 1; ++cell)
+            complete |= static_cast<State>(cell + 1) << (bits_per_tile * cell);
+        return complete;
+    }
+
+    State state{};
+    int emptyCell{ n_cells - 1 };
+
+public:
+    static constexpr State complete_state{ makeCompleteState() };
+
+    // Completed board
+    constexpr BasicPackedBoard()
+        : state{ complete_state }
+    {}
+
+    explicit BasicPackedBoard(const BasicBoard<Width, Height>& board)
+        : state{ 0 }
+    {
+        for (int cell{ 0 }; cell < n_cells; ++cell)
+        {
+            Tile tile{ board.getTile({ cell % Width, cell / Width }) };
+            if (tile.isEmpty())
+                emptyCell = cell;
+            state |= static_cast<State>(tile.getNum()) << (bits_per_tile * cell);
+        }
+    }
+
+    // Rebuild from a raw state word, e.g. one stored in a table of states
+    explicit BasicPackedBoard(State packed)
+        : state{ packed }
+    {
+        // Find the one zero tile: subtracting 1 from every tile only borrows
+        // into the top bit of a tile that was zero (or one above a borrow, which
+        // can only come after the lowest zero tile).
+        State low{ 0 };
+        for (int cell{ 0 }; cell < n_cells; ++cell)
+            low |= State{ 1 } << (bits_per_tile * cell);
+        State high{ low << (bits_per_tile - 1) };
+
+        State zeroTiles{ (state - low) & ~state & high };
+        assert(zeroTiles && "No empty tile in board.");
+
+        emptyCell = PackedTables::countTrailingZeros(zeroTiles) / bits_per_tile;
+    }
+
+    BasicBoard<Width, Height> toBoard() const
+    {
+        typename BasicBoard<Width, Height>::TileList tiles{};
+        for (int cell{ 0 }; cell < n_cells; ++cell)
+            tiles[cell] = Tile{ getTile(cell) };
+
+        return BasicBoard<Width, Height>{ tiles };
+    }
+
+    State getState() const { return state; }
+    int getEmptyCell() const { return emptyCell; }
+    int getTile(int cell) const { return static_cast<int>((state >> (bits_per_tile * cell)) & tile_mask); }
+    bool isComplete() const { return state == complete_state; }
+
+    static int getNeighbour(int cell, Direction dir)
+    {
+        return BoardTables::neighbours<Width, Height>[cell][dir.getDirection()];
+    }
+
+    // Same as Board::swapExecuted: slide the tile next to the empty one in direction dir
+    bool swapExecuted(Direction dir)
+    {
+        int from{ getNeighbour(emptyCell, dir) };
+        if (from == no_cell)
+            return false;
+
+        moveFrom(from);
+        return true;
+    }
+
+    // Slide the tile in cell 'from' (must neighbour the empty tile) into the empty cell
+    void moveFrom(int from)
+    {
+        State tile{ (state >> (bits_per_tile * from)) & tile_mask };
+        state ^= (tile << (bits_per_tile * from)) | (tile << (bits_per_tile * emptyCell));
+        emptyCell = from;
+    }
+
+    friend bool operator==(const BasicPackedBoard& b1, const BasicPackedBoard& b2) { return b1.state == b2.state; }
+    friend bool operator!=(const BasicPackedBoard& b1, const BasicPackedBoard& b2) { return b1.state != b2.state; }
+};
+
+using PackedBoard = BasicPackedBoard<4, 4>;
+
+#endif
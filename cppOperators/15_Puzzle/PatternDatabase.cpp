@@ -0,0 +1,555 @@
+#include "PatternDatabase.h"
+#include "PermutationRank.h"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+    constexpr int grid_size{ Board::getWidth() };
+    constexpr int n_cells{ PackedBoard::n_cells };
+    constexpr const auto& manhattan{ BoardTables::manhattan<grid_size, grid_size> };
+
+    constexpr int goalCell(int tile)
+    {
+        return BoardTables::goalCell<grid_size, grid_size>(tile);
+    }
+
+    using CellMask = std::uint32_t;
+    constexpr CellMask all_cells{ (CellMask{ 1 } << n_cells) - 1 };
+
+    constexpr CellMask makeColumnMask(int x)
+    {
+        CellMask mask{ 0 };
+        for (int y{ 0 }; y < grid_size; ++y)
+            mask |= CellMask{ 1 } << (y * grid_size + x);
+        return mask;
+    }
+    constexpr CellMask left_column{ makeColumnMask(0) };
+    constexpr CellMask right_column{ makeColumnMask(grid_size - 1) };
+
+    // Values in the build table: 15 (all bits set) marks a placement not
+    // reached yet, so the largest value stored is 14 (anything beyond is
+    // capped, which keeps the estimate admissible)
+    constexpr int max_value{ 14 };
+
+    // Words written or read at a time for checkpoints
+    constexpr std::uint64_t chunk_words{ 1 << 16 };
+
+    constexpr char file_magic[8]{ 'P', 'D', 'B', '1', '5', 'v', '1', '\0' };
+    constexpr char part_magic[8]{ 'P', 'D', 'B', 'p', 'a', 'r', 't', '\0' };
+
+    // All cells next to any cell in mask
+    CellMask getAdjacentCells(CellMask mask)
+    {
+        return (((mask & ~left_column) >> 1)
+              | ((mask & ~right_column) << 1)
+              | (mask << grid_size)
+              | (mask >> grid_size)) & all_cells;
+    }
+
+    // Free cells the empty tile can reach from cell without moving a pattern tile
+    CellMask getRegion(int cell, CellMask freeCells)
+    {
+        CellMask region{ CellMask{ 1 } << cell };
+        while (true)
+        {
+            CellMask grown{ region | (getAdjacentCells(region) & freeCells) };
+            if (grown == region)
+                return region;
+            region = grown;
+        }
+    }
+
+    int lowestCell(CellMask mask)
+    {
+        return __builtin_ctz(mask);
+    }
+
+    int getNibble(std::uint64_t word, int index)
+    {
+        return static_cast<int>((word >> (4 * index)) & 0xF);
+    }
+
+    // Breadth-first search over the abstract states of one pattern: where its
+    // tiles are, plus which region of free cells holds the empty tile (named
+    // by the region's lowest cell). Moving the empty tile inside its region is
+    // free; sliding a pattern tile into it costs one move.
+    //
+    // A move that takes a tile away from its goal raises both the move count
+    // and Manhattan distance by one, so the stored value (moves - distance) / 2
+    // is unchanged; a move towards the goal raises the value by one. The search
+    // therefore runs in layers of stored value, each layer repeatedly scanning
+    // the table until no new placement of that value turns up.
+    class PatternBuilder
+    {
+    private:
+        PatternDatabase::Pattern tiles{};
+        int count{};
+        std::uint64_t rankCount{};
+
+        // One word per placement rank, holding a 4 bit value for every region
+        std::unique_ptr<std::atomic<std::uint64_t>[]> values{};
+        std::vector<std::uint16_t> expanded{};
+
+        void getCells(std::uint64_t rank, int* cells) const;
+        void lowerValue(std::uint64_t rank, int region, int value);
+        bool expandRange(int layer, std::uint64_t begin, std::uint64_t end);
+        bool expandLayer(int layer, int threads);
+
+        bool saveCheckpoint(const std::string& filename, int layer) const;
+        int loadCheckpoint(const std::string& filename);
+
+    public:
+        explicit PatternBuilder(const PatternDatabase::Pattern& pattern);
+
+        bool run(const std::string& checkpoint, int threads);
+        std::vector<std::uint8_t> getPackedTable() const;
+    };
+
+    PatternBuilder::PatternBuilder(const PatternDatabase::Pattern& pattern)
+        : tiles{ pattern }
+        , count{ static_cast<int>(pattern.size()) }
+        , rankCount{ PatternDatabase::getRankCount(count) }
+        , values{ std::make_unique<std::atomic<std::uint64_t>[]>(rankCount) }
+        , expanded(rankCount)
+    {
+        for (std::uint64_t rank{ 0 }; rank < rankCount; ++rank)
+            values[rank].store(~std::uint64_t{ 0 }, std::memory_order_relaxed);
+    }
+
+    void PatternBuilder::getCells(std::uint64_t rank, int* cells) const
+    {
+        PermutationRank::getPermutation(rank, cells, count, n_cells);
+    }
+
+    void PatternBuilder::lowerValue(std::uint64_t rank, int region, int value)
+    {
+        std::atomic<std::uint64_t>& word{ values[rank] };
+        std::uint64_t old{ word.load(std::memory_order_relaxed) };
+        while (getNibble(old, region) > value)
+        {
+            std::uint64_t updated{ (old & ~(std::uint64_t{ 0xF } << (4 * region)))
+                                 | (static_cast<std::uint64_t>(value) << (4 * region)) };
+            if (word.compare_exchange_weak(old, updated, std::memory_order_relaxed))
+                return;
+        }
+    }
+
+    bool PatternBuilder::expandRange(int layer, std::uint64_t begin, std::uint64_t end)
+    {
+        bool anyExpanded{ false };
+        int cells[n_cells]{};
+
+        for (std::uint64_t rank{ begin }; rank < end; ++rank)
+        {
+            std::uint64_t word{ values[rank].load(std::memory_order_relaxed) };
+            bool cellsKnown{ false };
+
+            for (int region{ 0 }; region < n_cells; ++region)
+            {
+                if (getNibble(word, region) != layer || (expanded[rank] & (1u << region)))
+                    continue;
+
+                expanded[rank] |= static_cast<std::uint16_t>(1u << region);
+                anyExpanded = true;
+
+                if (!cellsKnown)
+                {
+                    getCells(rank, cells);
+                    cellsKnown = true;
+                }
+
+                CellMask occupied{ 0 };
+                for (int i{ 0 }; i < count; ++i)
+                    occupied |= CellMask{ 1 } << cells[i];
+                CellMask freeCells{ all_cells & ~occupied };
+                CellMask reachable{ getRegion(region, freeCells) };
+
+                for (int i{ 0 }; i < count; ++i)
+                {
+                    int from{ cells[i] };
+                    CellMask targets{ getAdjacentCells(CellMask{ 1 } << from) & reachable };
+
+                    while (targets)
+                    {
+                        int to{ lowestCell(targets) };
+                        targets &= targets - 1;
+
+                        // Slide tile i from 'from' into 'to', the empty tile takes its place
+                        cells[i] = to;
+                        CellMask nextFree{ (freeCells | (CellMask{ 1 } << from)) & ~(CellMask{ 1 } << to) };
+                        int nextRegion{ lowestCell(getRegion(from, nextFree)) };
+                        std::uint64_t nextRank{ PatternDatabase::getRank(cells, count) };
+                        cells[i] = from;
+
+                        int tile{ tiles[i] };
+                        bool closer{ manhattan[tile][to] < manhattan[tile][from] };
+                        int nextValue{ std::min(layer + (closer ? 1 : 0), max_value) };
+
+                        lowerValue(nextRank, nextRegion, nextValue);
+                    }
+                }
+            }
+        }
+
+        return anyExpanded;
+    }
+
+    bool PatternBuilder::expandLayer(int layer, int threads)
+    {
+        constexpr std::uint64_t chunk_size{ 1 << 14 };
+        bool anyExpanded{ false };
+
+        while (true)
+        {
+            std::atomic<std::uint64_t> nextChunk{ 0 };
+            std::atomic<bool> passExpanded{ false };
+
+            auto worker{ [&]() {
+                while (true)
+                {
+                    std::uint64_t begin{ nextChunk.fetch_add(chunk_size) };
+                    if (begin >= rankCount)
+                        return;
+                    if (expandRange(layer, begin, std::min(begin + chunk_size, rankCount)))
+                        passExpanded = true;
+                }
+            } };
+
+            std::vector<std::thread> pool{};
+            for (int t{ 1 }; t < threads; ++t)
+                pool.emplace_back(worker);
+            worker();
+            for (auto& thread : pool)
+                thread.join();
+
+            if (!passExpanded)
+                return anyExpanded;
+            anyExpanded = true;
+        }
+    }
+
+    bool PatternBuilder::saveCheckpoint(const std::string& filename, int layer) const
+    {
+        std::string temp{ filename + ".tmp" };
+        std::ofstream out{ temp, std::ios::binary };
+        if (!out)
+            return false;
+
+        std::int32_t header[2]{ count, layer };
+        out.write(part_magic, sizeof(part_magic));
+        out.write(reinterpret_cast<const char*>(header), sizeof(header));
+        for (int tile : tiles)
+        {
+            std::int32_t t{ tile };
+            out.write(reinterpret_cast<const char*>(&t), sizeof(t));
+        }
+
+        std::vector<std::uint64_t> buffer(chunk_words);
+        for (std::uint64_t begin{ 0 }; begin < rankCount; begin += chunk_words)
+        {
+            std::uint64_t size{ std::min(chunk_words, rankCount - begin) };
+            for (std::uint64_t i{ 0 }; i < size; ++i)
+                buffer[i] = values[begin + i].load(std::memory_order_relaxed);
+            out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(size * sizeof(std::uint64_t)));
+        }
+
+        out.close();
+        if (!out)
+            return false;
+
+        return std::rename(temp.c_str(), filename.c_str()) == 0;
+    }
+
+    // Returns last completed layer, or -1 if there is no usable checkpoint
+    int PatternBuilder::loadCheckpoint(const std::string& filename)
+    {
+        std::ifstream in{ filename, std::ios::binary };
+        if (!in)
+            return -1;
+
+        char magic[8]{};
+        std::int32_t header[2]{};
+        in.read(magic, sizeof(magic));
+        in.read(reinterpret_cast<char*>(header), sizeof(header));
+        if (!in || std::memcmp(magic, part_magic, sizeof(magic)) != 0 || header[0] != count)
+            return -1;
+
+        for (int tile : tiles)
+        {
+            std::int32_t t{};
+            in.read(reinterpret_cast<char*>(&t), sizeof(t));
+            if (t != tile)
+                return -1;
+        }
+
+        int layer{ header[1] };
+        std::vector<std::uint64_t> buffer(chunk_words);
+        for (std::uint64_t begin{ 0 }; begin < rankCount; begin += chunk_words)
+        {
+            std::uint64_t size{ std::min(chunk_words, rankCount - begin) };
+            in.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(size * sizeof(std::uint64_t)));
+            if (!in)
+                return -1;
+
+            // Everything up to the completed layer has been expanded already
+            for (std::uint64_t i{ 0 }; i < size; ++i)
+            {
+                values[begin + i].store(buffer[i], std::memory_order_relaxed);
+                std::uint16_t done{ 0 };
+                for (int region{ 0 }; region < n_cells; ++region)
+                {
+                    if (getNibble(buffer[i], region) <= layer)
+                        done |= static_cast<std::uint16_t>(1u << region);
+                }
+                expanded[begin + i] = done;
+            }
+        }
+
+        return layer;
+    }
+
+    bool PatternBuilder::run(const std::string& checkpoint, int threads)
+    {
+        int layer{ loadCheckpoint(checkpoint) };
+        if (layer >= 0)
+        {
+            std::cout << "Resuming pattern from layer " << layer + 1 << '\n';
+        }
+        else
+        {
+            // Start from the completed board: tiles on their goals, empty tile bottom right
+            int cells[n_cells]{};
+            CellMask occupied{ 0 };
+            for (int i{ 0 }; i < count; ++i)
+            {
+                cells[i] = goalCell(tiles[i]);
+                occupied |= CellMask{ 1 } << cells[i];
+            }
+            int region{ lowestCell(getRegion(goalCell(0), all_cells & ~occupied)) };
+            lowerValue(PatternDatabase::getRank(cells, count), region, 0);
+        }
+
+        for (++layer; layer <= max_value; ++layer)
+        {
+            expandLayer(layer, threads);
+            std::cout << "  layer " << layer << " done\n";
+            if (!saveCheckpoint(checkpoint, layer))
+                return false;
+        }
+
+        return true;
+    }
+
+    std::vector<std::uint8_t> PatternBuilder::getPackedTable() const
+    {
+        // Placement value is the best over every region the empty tile could be in
+        std::vector<std::uint8_t> packed((rankCount + 1) / 2);
+        for (std::uint64_t rank{ 0 }; rank < rankCount; ++rank)
+        {
+            std::uint64_t word{ values[rank].load(std::memory_order_relaxed) };
+            int best{ max_value };
+            for (int region{ 0 }; region < n_cells; ++region)
+                best = std::min(best, getNibble(word, region));
+
+            packed[rank / 2] |= static_cast<std::uint8_t>(best << (4 * (rank % 2)));
+        }
+        return packed;
+    }
+}
+
+const PatternDatabase::Partition& PatternDatabase::getPartition663()
+{
+    static const Partition partition{
+        { 1, 5, 6, 9, 10, 13 },
+        { 7, 8, 11, 12, 14, 15 },
+        { 2, 3, 4 }
+    };
+    return partition;
+}
+
+const PatternDatabase::Partition& PatternDatabase::getPartition78()
+{
+    static const Partition partition{
+        { 1, 5, 6, 9, 10, 13, 14 },
+        { 2, 3, 4, 7, 8, 11, 12, 15 }
+    };
+    return partition;
+}
+
+std::uint64_t PatternDatabase::getRankCount(int count)
+{
+    return PermutationRank::getPartialCount(n_cells, count);
+}
+
+std::uint64_t PatternDatabase::getRank(const int* cells, int count)
+{
+    return PermutationRank::getRank(cells, count, n_cells);
+}
+
+bool PatternDatabase::build(const Partition& partition, const std::string& filename, int threads)
+{
+    std::vector<std::vector<std::uint8_t>> packed{};
+
+    for (std::size_t p{ 0 }; p < partition.size(); ++p)
+    {
+        std::cout << "Building pattern " << p + 1 << " of " << partition.size()
+                  << " (" << partition[p].size() << " tiles)\n";
+
+        PatternBuilder builder{ partition[p] };
+        if (!builder.run(filename + ".part" + std::to_string(p), threads))
+            return false;
+        packed.push_back(builder.getPackedTable());
+    }
+
+    std::ofstream out{ filename, std::ios::binary };
+    if (!out)
+        return false;
+
+    std::int32_t patternCount{ static_cast<std::int32_t>(partition.size()) };
+    out.write(file_magic, sizeof(file_magic));
+    out.write(reinterpret_cast<const char*>(&patternCount), sizeof(patternCount));
+    for (std::size_t p{ 0 }; p < partition.size(); ++p)
+    {
+        std::int32_t count{ static_cast<std::int32_t>(partition[p].size()) };
+        out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        for (int tile : partition[p])
+        {
+            std::int32_t t{ tile };
+            out.write(reinterpret_cast<const char*>(&t), sizeof(t));
+        }
+        out.write(reinterpret_cast<const char*>(packed[p].data()), static_cast<std::streamsize>(packed[p].size()));
+    }
+
+    out.close();
+    if (!out)
+        return false;
+
+    for (std::size_t p{ 0 }; p < partition.size(); ++p)
+        std::remove((filename + ".part" + std::to_string(p)).c_str());
+
+    return true;
+}
+
+PatternDatabase::PatternDatabase(const std::string& filename)
+{
+    std::fill(std::begin(patternOf), std::end(patternOf), -1);
+
+    int fd{ open(filename.c_str(), O_RDONLY) };
+    if (fd < 0)
+        return;
+
+    struct stat info{};
+    if (fstat(fd, &info) == 0 && info.st_size > 0)
+    {
+        mappingSize = static_cast<std::size_t>(info.st_size);
+        void* address{ mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, 0) };
+        if (address != MAP_FAILED)
+            mapping = address;
+    }
+    close(fd);
+
+    if (!mapping)
+        return;
+
+    // Walk the headers, checking every table fits inside the file
+    const std::uint8_t* bytes{ static_cast<const std::uint8_t*>(mapping) };
+    std::size_t offset{ 0 };
+    auto readInt{ [&](std::int32_t& value) {
+        if (offset + sizeof(value) > mappingSize)
+            return false;
+        std::memcpy(&value, bytes + offset, sizeof(value));
+        offset += sizeof(value);
+        return true;
+    } };
+
+    std::int32_t patternCount{};
+    bool valid{ mappingSize >= sizeof(file_magic)
+             && std::memcmp(bytes, file_magic, sizeof(file_magic)) == 0 };
+    offset = sizeof(file_magic);
+    valid = valid && readInt(patternCount);
+
+    for (int p{ 0 }; valid && p < patternCount; ++p)
+    {
+        std::int32_t count{};
+        valid = readInt(count) && count > 0 && count < n_cells;
+
+        Table table{};
+        for (int i{ 0 }; valid && i < count; ++i)
+        {
+            std::int32_t tile{};
+            valid = readInt(tile) && tile > 0 && tile < n_cells && patternOf[tile] < 0;
+            if (valid)
+            {
+                patternOf[tile] = p;
+                table.tiles.push_back(tile);
+            }
+        }
+        if (!valid)
+            break;
+
+        std::size_t size{ static_cast<std::size_t>((getRankCount(count) + 1) / 2) };
+        valid = offset + size <= mappingSize;
+        table.data = bytes + offset;
+        offset += size;
+        tables.push_back(table);
+    }
+
+    if (!valid)
+    {
+        std::cerr << "Invalid pattern database file: " << filename << '\n';
+        munmap(mapping, mappingSize);
+        mapping = nullptr;
+        tables.clear();
+        std::fill(std::begin(patternOf), std::end(patternOf), -1);
+    }
+}
+
+PatternDatabase::~PatternDatabase()
+{
+    if (mapping)
+        munmap(mapping, mappingSize);
+}
+
+int PatternDatabase::getValue(int pattern, const int* tileCells) const
+{
+    const Table& table{ tables[static_cast<std::size_t>(pattern)] };
+
+    int cells[n_cells]{};
+    int count{ static_cast<int>(table.tiles.size()) };
+    for (int i{ 0 }; i < count; ++i)
+        cells[i] = tileCells[table.tiles[static_cast<std::size_t>(i)]];
+
+    std::uint64_t rank{ getRank(cells, count) };
+    return (table.data[rank / 2] >> (4 * (rank % 2))) & 0xF;
+}
+
+int PatternDatabase::getHeuristic(const PackedBoard& board) const
+{
+    int tileCells[n_cells]{};
+    int distance{ 0 };
+    for (int cell{ 0 }; cell < n_cells; ++cell)
+    {
+        int tile{ board.getTile(cell) };
+        tileCells[tile] = cell;
+        distance += manhattan[tile][cell];
+    }
+
+    int extra{ 0 };
+    for (int p{ 0 }; p < getPatternCount(); ++p)
+        extra += 2 * getValue(p, tileCells);
+
+    return distance + extra;
+}
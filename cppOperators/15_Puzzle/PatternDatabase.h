@@ -0,0 +1,79 @@
+#ifndef PATTERN_DATABASE_H
+#define PATTERN_DATABASE_H
+
+#include "PackedBoard.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Additive disjoint pattern database (PDB) for the 15 puzzle.
+//
+// The tiles are split into disjoint patterns (e.g. 6-6-3). For each pattern,
+// every placement of its tiles is stored with the fewest moves *of those tiles*
+// needed to reach their goal cells, all other tiles treated as indistinct.
+// Only pattern moves are counted, so values from different patterns add up to
+// an admissible estimate that is much stronger than Manhattan distance.
+//
+// Each value is stored as (pattern moves - pattern Manhattan distance) / 2 in
+// 4 bits (the difference is always even), two entries per byte. The file is
+// memory-mapped when loaded, so startup costs nothing beyond touching pages.
+class PatternDatabase
+{
+public:
+    using Pattern = std::vector<int>;   // tile numbers in one pattern
+    using Partition = std::vector<Pattern>;
+
+    static constexpr int n_cells{ PackedBoard::n_cells };
+
+    // Standard partitions, see Korf & Felner (2002)
+    static const Partition& getPartition663();
+    static const Partition& getPartition78();
+
+    // Builds every pattern of the partition using 'threads' threads and writes
+    // the database to filename. Progress is checkpointed after each BFS layer in
+    // filename + ".partN", so an interrupted build picks up where it stopped.
+    // Returns false if a file could not be written.
+    static bool build(const Partition& partition, const std::string& filename, int threads);
+
+    // Rank of a placement of k tiles over the 16 cells (k-permutation index)
+    static std::uint64_t getRank(const int* cells, int count);
+    static std::uint64_t getRankCount(int count);
+
+private:
+    struct Table
+    {
+        Pattern tiles{};
+        const std::uint8_t* data{ nullptr };
+    };
+
+    std::vector<Table> tables{};
+    int patternOf[n_cells]{};           // pattern index for each tile, -1 if none
+
+    void* mapping{ nullptr };
+    std::size_t mappingSize{ 0 };
+
+public:
+    PatternDatabase() = default;
+
+    // Memory-maps a database written by build(). Check isLoaded() afterwards.
+    explicit PatternDatabase(const std::string& filename);
+    ~PatternDatabase();
+
+    PatternDatabase(const PatternDatabase&) = delete;
+    PatternDatabase& operator=(const PatternDatabase&) = delete;
+
+    bool isLoaded() const { return mapping != nullptr; }
+
+    int getPatternCount() const { return static_cast<int>(tables.size()); }
+    int getPatternOf(int tile) const { return patternOf[tile]; }
+
+    // Stored value of one pattern, given the cell of every tile (tileCells[tile]).
+    // Extra moves over Manhattan distance for the pattern are twice this value.
+    int getValue(int pattern, const int* tileCells) const;
+
+    // Full heuristic: Manhattan distance plus the extra moves from every pattern
+    int getHeuristic(const PackedBoard& board) const;
+};
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef PERMUTATION_RANK_H
+#define PERMUTATION_RANK_H
+
+#include "BoardTables.h"
+#include "PackedBoard.h"
+#include <cassert>
+#include <cstdint>
+
+// Perfect hashing of tile arrangements: each arrangement of a board maps to a
+// unique index (rank) in 0..(cells! - 1) and back, via the Lehmer code.
+//
+// Digit i of the Lehmer code is how many unused values are smaller than
+// perm[i]. Keeping the used values in a bitmask makes that one popcount, so
+// ranking is O(n).
+namespace PermutationRank
+{
+    using Rank = std::uint64_t;
+
+    // Largest n with n! < 2^64 is 20
+    constexpr int max_items{ 20 };
+
+    constexpr Rank getFactorial(int n)
+    {
+        Rank result{ 1 };
+        for (int i{ 2 }; i <= n; ++i)
+            result *= static_cast<Rank>(i);
+        return result;
+    }
+
+    // Number of ways to place 'count' of 'n' distinct items in order: n! / (n - count)!
+    constexpr Rank getPartialCount(int n, int count)
+    {
+        Rank result{ 1 };
+        for (int i{ 0 }; i < count; ++i)
+            result *= static_cast<Rank>(n - i);
+        return result;
+    }
+
+    // Rank of the first 'count' values of a permutation of 0..(n - 1), in
+    // 0..getPartialCount(n, count) - 1. With count == n this ranks the whole
+    // permutation.
+    inline Rank getRank(const int* perm, int count, int n)
+    {
+        assert(n <= 32 && count <= max_items && "Too many items to rank.");
+
+        Rank rank{ 0 };
+        std::uint32_t used{ 0 };
+        for (int i{ 0 }; i < count; ++i)
+        {
+            std::uint32_t below{ (std::uint32_t{ 1 } << perm[i]) - 1 };
+            int digit{ perm[i] - __builtin_popcount(used & below) };
+            rank = rank * static_cast<Rank>(n - i) + static_cast<Rank>(digit);
+            used |= std::uint32_t{ 1 } << perm[i];
+        }
+        return rank;
+    }
+
+    // Inverse of getRank()
+    inline void getPermutation(Rank rank, int* perm, int count, int n)
+    {
+        int digits[32]{};
+        for (int i{ count - 1 }; i >= 0; --i)
+        {
+            digits[i] = static_cast<int>(rank % static_cast<Rank>(n - i));
+            rank /= static_cast<Rank>(n - i);
+        }
+
+        // Each digit picks among the values not used so far
+        std::uint32_t unused{ (n == 32) ? ~std::uint32_t{ 0 } : (std::uint32_t{ 1 } << n) - 1 };
+        for (int i{ 0 }; i < count; ++i)
+        {
+            std::uint32_t remaining{ unused };
+            for (int skip{ 0 }; skip < digits[i]; ++skip)
+                remaining &= remaining - 1;
+
+            perm[i] = __builtin_ctz(remaining);
+            unused &= ~(std::uint32_t{ 1 } << perm[i]);
+        }
+    }
+
+    // Rank of a board: the permutation is the tile number held by each cell
+    template <int Width, int Height>
+    Rank getRank(const BasicPackedBoard<Width, Height>& board)
+    {
+        static_assert(Width * Height <= max_items, "Board too large to rank in 64 bits.");
+
+        int perm[Width * Height]{};
+        for (int cell{ 0 }; cell < Width * Height; ++cell)
+            perm[cell] = board.getTile(cell);
+
+        return getRank(perm, Width * Height, Width * Height);
+    }
+
+    template <int Width, int Height>
+    BasicPackedBoard<Width, Height> getBoard(Rank rank)
+    {
+        static_assert(Width * Height <= max_items, "Board too large to rank in 64 bits.");
+
+        using PackedType = BasicPackedBoard<Width, Height>;
+        int perm[Width * Height]{};
+        getPermutation(rank, perm, Width * Height, Width * Height);
+
+        typename PackedType::State state{ 0 };
+        for (int cell{ 0 }; cell < Width * Height; ++cell)
+            state |= static_cast<typename PackedType::State>(perm[cell]) << (PackedType::bits_per_tile * cell);
+
+        return PackedType{ state };
+    }
+
+    template <int Width, int Height>
+    constexpr Rank getRankCount()
+    {
+        return getFactorial(Width * Height);
+    }
+}
+
+#endif
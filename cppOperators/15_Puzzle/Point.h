@@ -20,15 +20,11 @@ struct Point
 
     Point getAdjacentPoint(Direction dir) const
     {
-        switch (dir.getDirection())
-        {
-        case Direction::up: return Point { x, y - 1 }; 
-        case Direction::left : return Point { x - 1, y};
-        case Direction::down : return Point { x, y + 1};
-        case Direction::right: return Point { x + 1, y };
-        }
+        // Offsets indexed by Direction::Type: up, down, left, right
+        constexpr int dx[Direction::max_directions]{ 0, 0, -1, 1 };
+        constexpr int dy[Direction::max_directions]{ -1, 1, 0, 0 };
 
-        return *this;
+        return Point{ x + dx[dir.getDirection()], y + dy[dir.getDirection()] };
     }
 };
 
@@ -0,0 +1,209 @@
+#ifndef RENDERER_H
+#define RENDERER_H
+
+#include "Point.h"
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+
+constexpr int g_consoleLines{ 25 };
+
+namespace RenderTables
+{
+    // Four characters per tile number, as Tile's operator<< prints them
+    template <int Cells>
+    constexpr auto makeCellText()
+    {
+        std::array<std::array<char, 4>, Cells> table{};
+        for (int tile{ 0 }; tile < Cells; ++tile)
+        {
+            table[tile][0] = ' ';
+            table[tile][1] = (tile >= 10) ? static_cast<char>('0' + tile / 10) : ' ';
+            table[tile][2] = (tile == 0) ? ' ' : static_cast<char>('0' + tile % 10);
+            table[tile][3] = ' ';
+        }
+        return table;
+    }
+
+    template <int Cells>
+    inline constexpr auto cellText{ makeCellText<Cells>() };
+}
+
+template <int Width, int Height>
+class BasicBoard;
+
+template <int Width, int Height>
+class BasicPackedBoard;
+
+// Formats whole frames of a Width x Height board into a fixed buffer, so a
+// frame is built without allocating and can be written with one call.
+//
+// Modes:
+// - scroll:     blank lines then the board, as operator<< has always printed
+// - cursorHome: ANSI cursor-home, the board, then clear the rest of the screen
+// - diff:       after the first (cursor-home) frame, only the cells that changed,
+//               each behind an ANSI cursor-position code
+template <int Width, int Height>
+class BasicRenderer
+{
+public:
+    enum Mode
+    {
+        scroll,
+        cursorHome,
+        diff,
+    };
+
+    static constexpr int scroll_lines{ g_consoleLines };
+    static constexpr int cell_width{ 4 };
+
+private:
+    static constexpr int n_cells{ Width * Height };
+    static_assert(n_cells <= 100, "Cells are 4 characters wide: tile numbers must fit in 2 digits.");
+
+    static constexpr std::string_view home{ "\x1b[H" };
+    static constexpr std::string_view clear_below{ "\x1b[J" };
+
+    // Longest cursor-position code: ESC [ row ; column H
+    static constexpr int max_position_size{ 2 + 3 + 1 + 3 + 1 };
+    static constexpr int row_size{ Width * cell_width + 1 };
+    static constexpr int max_frame_size{
+        scroll_lines + static_cast<int>(home.size() + clear_below.size())
+        + n_cells * (max_position_size + cell_width) + Height * row_size + max_position_size
+    };
+
+    Mode mode{ scroll };
+    std::array<char, max_frame_size> buffer{};
+    int size{ 0 };
+
+    // Tiles of the last frame drawn, for diff mode
+    std::array<int, n_cells> previous{};
+    bool hasPrevious{ false };
+
+    static int tileAt(const BasicBoard<Width, Height>& board, int cell)
+    {
+        return board.getTile(Point{ cell % Width, cell / Width }).getNum();
+    }
+
+    static int tileAt(const BasicPackedBoard<Width, Height>& board, int cell)
+    {
+        return board.getTile(cell);
+    }
+
+    void append(std::string_view text)
+    {
+        std::memcpy(buffer.data() + size, text.data(), text.size());
+        size += static_cast<int>(text.size());
+    }
+
+    void appendNumber(int number)
+    {
+        char digits[4]{};
+        int count{ 0 };
+        do
+        {
+            digits[count++] = static_cast<char>('0' + number % 10);
+            number /= 10;
+        } while (number > 0);
+
+        while (count > 0)
+            buffer[size++] = digits[--count];
+    }
+
+    // Cursor to row y, column x (0-based) of the screen
+    void appendPosition(int y, int x)
+    {
+        append("\x1b[");
+        appendNumber(y + 1);
+        buffer[size++] = ';';
+        appendNumber(x + 1);
+        buffer[size++] = 'H';
+    }
+
+    void appendCell(int tile)
+    {
+        std::memcpy(buffer.data() + size, RenderTables::cellText<n_cells>[tile].data(), cell_width);
+        size += cell_width;
+    }
+
+    void appendBoard(const std::array<int, n_cells>& tiles)
+    {
+        for (int y{ 0 }; y < Height; ++y)
+        {
+            for (int x{ 0 }; x < Width; ++x)
+                appendCell(tiles[y * Width + x]);
+            buffer[size++] = '\n';
+        }
+    }
+
+public:
+    explicit BasicRenderer(Mode renderMode = cursorHome)
+        : mode{ renderMode }
+    {}
+
+    Mode getMode() const { return mode; }
+
+    // Next diff frame redraws the whole board (e.g. after other output)
+    void invalidate() { hasPrevious = false; }
+
+    // Frame for the given tiles, listed row by row. The view stays valid
+    // until the next call.
+    std::string_view render(const std::array<int, n_cells>& tiles)
+    {
+        size = 0;
+
+        if (mode == scroll)
+        {
+            std::memset(buffer.data(), '\n', scroll_lines);
+            size = scroll_lines;
+            appendBoard(tiles);
+        }
+        else if (mode == cursorHome || !hasPrevious)
+        {
+            append(home);
+            appendBoard(tiles);
+            append(clear_below);
+        }
+        else
+        {
+            for (int cell{ 0 }; cell < n_cells; ++cell)
+            {
+                if (tiles[cell] != previous[cell])
+                {
+                    appendPosition(cell / Width, (cell % Width) * cell_width);
+                    appendCell(tiles[cell]);
+                }
+            }
+            // Leave the cursor under the board, where a full frame leaves it
+            appendPosition(Height, 0);
+        }
+
+        previous = tiles;
+        hasPrevious = true;
+        return std::string_view{ buffer.data(), static_cast<std::size_t>(size) };
+    }
+
+    // Works for Board and PackedBoard of the same size
+    template <typename BoardType>
+    std::string_view render(const BoardType& board)
+    {
+        std::array<int, n_cells> tiles{};
+        for (int cell{ 0 }; cell < n_cells; ++cell)
+            tiles[cell] = tileAt(board, cell);
+        return render(tiles);
+    }
+
+    // Renders and writes the frame with a single write
+    template <typename BoardType>
+    void draw(const BoardType& board, std::FILE* out = stdout)
+    {
+        std::string_view frame{ render(board) };
+        std::fwrite(frame.data(), 1, frame.size(), out);
+        std::fflush(out);
+    }
+};
+
+using Renderer = BasicRenderer<4, 4>;
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef SCRAMBLER_H
+#define SCRAMBLER_H
+
+#include "BoardTables.h"
+#include "../../cppCommon/Random.h"
+#include "Tile.h"
+#include <cstddef>
+#include <utility>
+
+// Uniformly random solvable boards in O(cells): shuffle every tile (empty one
+// included), then if the result cannot be solved, swap the first two numbered
+// tiles. That swap pairs each unsolvable board with exactly one solvable board,
+// so every solvable board stays equally likely.
+namespace Scrambler
+{
+    template <int Width, int Height, typename TileList, typename Generator>
+    void scramble(TileList& tiles, Generator& gen)
+    {
+        constexpr int n_cells{ Width * Height };
+        for (int cell{ 0 }; cell < n_cells; ++cell)
+            tiles[cell] = Tile{ (cell + 1) % n_cells };
+
+        // Fisher-Yates
+        for (int cell{ n_cells - 1 }; cell > 0; --cell)
+        {
+            std::swap(tiles[cell], tiles[Random::get(gen, 0, cell)]);
+        }
+
+        if (!BoardTables::isSolvable<Width, Height>([&tiles](int cell) { return tiles[cell].getNum(); }))
+        {
+            int first{ tiles[0].isEmpty() ? 1 : 0 };
+            int second{ (tiles[first + 1].isEmpty()) ? first + 2 : first + 1 };
+            std::swap(tiles[first], tiles[second]);
+        }
+    }
+
+    // Fills boards[0..count) with independent random solvable boards
+    template <typename BoardType, typename Generator>
+    void fillRandomBoards(BoardType* boards, std::size_t count, Generator& gen)
+    {
+        typename BoardType::TileList tiles{};
+        for (std::size_t i{ 0 }; i < count; ++i)
+        {
+            scramble<BoardType::getWidth(), BoardType::getHeight()>(tiles, gen);
+            boards[i] = BoardType{ tiles };
+        }
+    }
+
+    template <typename BoardType>
+    void fillRandomBoards(BoardType* boards, std::size_t count)
+    {
+        fillRandomBoards(boards, count, Random::getGenerator());
+    }
+}
+
+#endif
@@ -0,0 +1,269 @@
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include "Board.h"
+#include "BoardTables.h"
+#include "Direction.h"
+#include "Heuristic.h"
+#include "PackedBoard.h"
+#include "PatternDatabase.h"
+#include "TranspositionTable.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// Optimal solver for Width x Height sliding puzzles using iterative-deepening
+// A* (IDA*). Heuristic is Manhattan distance plus linear conflict, both updated
+// incrementally as the search moves the empty tile around. For the 15 puzzle,
+// given a pattern database, the larger of its extra moves and the linear
+// conflicts is used.
+//
+// An optional transposition table cuts boards already reached as cheaply in
+// the same iteration, and remembers the lower bounds each finished board
+// proved, tightening the estimate later. A board's bound is the smallest over
+// all its neighbours, the parent it was reached from included, so it holds
+// however the board is reached. Moves so far only count within one pass of
+// one solver (its own table generation), so solvers on any number of threads
+// can share a table.
+template <int Width, int Height>
+class BasicSolver
+{
+private:
+    static constexpr int n_cells{ Width * Height };
+    static constexpr int n_dirs{ Direction::max_directions };
+    static constexpr int found{ -1 };
+    static constexpr int pruned{ -2 };
+    static constexpr bool can_use_patterns{ n_cells == PatternDatabase::n_cells && Width == 4 };
+
+    // Direction that undoes each move (up <-> down, left <-> right)
+    static constexpr int opposite[n_dirs]{ Direction::down, Direction::up, Direction::right, Direction::left };
+
+    static constexpr const auto& neighbourTable{ BoardTables::neighbours<Width, Height> };
+
+    BasicPackedBoard<Width, Height> state{};
+    Heuristic::Estimate<Width, Height> heuristic{};     // Manhattan distance and linear conflicts
+
+    const PatternDatabase* database{ nullptr };
+    int tileCells[n_cells]{};        // cell holding each tile
+    int patternExtra[n_cells]{};     // extra moves over Manhattan distance for each pattern
+    int totalPatternExtra{ 0 };
+
+    TranspositionTable* table{ nullptr };
+    int generation{ 0 };             // this pass's g values in the table
+    Zobrist::Hash hash{ 0 };
+
+    std::vector<Direction> path{};
+    long long nodesExpanded{ 0 };
+    const std::atomic<bool>* stop{ nullptr };
+
+    int search(int g, int bound, int prevDir)
+    {
+        // Another thread has finished the job, unwind without storing anything
+        if (stop && stop->load(std::memory_order_relaxed))
+            return pruned;
+
+        int estimate{ getEstimate() };
+        if (table)
+        {
+            TranspositionTable::Entry entry{};
+            if (table->probe(hash, generation, entry))
+            {
+                // Reached as cheaply earlier this iteration, that search covered this one
+                if (entry.g <= g)
+                    return pruned;
+                estimate = std::max(estimate, entry.bound);
+            }
+        }
+
+        int f{ g + estimate };
+        if (f > bound)
+            return f;
+        if (heuristic.manhattan == 0)
+            return found;
+
+        ++nodesExpanded;
+        if (table)
+            table->store(hash, generation, g, estimate);
+
+        int nextBound{ std::numeric_limits<int>::max() };
+        int learned{ std::numeric_limits<int>::max() };  // lower bound on moves left, from the neighbours
+
+        for (int dir{ 0 }; dir < n_dirs; ++dir)
+        {
+            int oldEmpty{ state.getEmptyCell() };
+            int from{ neighbourTable[oldEmpty][dir] };
+            if (from == BoardTables::no_cell)
+                continue;
+
+            // The move back to the parent is not searched, but a shortest path
+            // may still start with it: its stored bound is part of the minimum
+            if (prevDir >= 0 && dir == opposite[prevDir])
+            {
+                if (table)
+                    learned = std::min(learned, 1 + getChildBound(from, oldEmpty, state.getTile(from)));
+                continue;
+            }
+
+            // Slide tile into the empty cell
+            int tile{ state.getTile(from) };
+            Heuristic::Estimate<Width, Height> oldHeuristic{ heuristic };
+            state.moveFrom(from);
+            Heuristic::applyMove(heuristic, tile, from, oldEmpty);
+            Zobrist::Hash hashDelta{ Zobrist::getMoveDelta<Width, Height>(tile, from, oldEmpty) };
+            hash ^= hashDelta;
+
+            // Only the pattern holding the moved tile changes its value
+            int pattern{ database ? database->getPatternOf(tile) : -1 };
+            int oldExtra{ 0 };
+            if (pattern >= 0)
+            {
+                tileCells[tile] = oldEmpty;
+                oldExtra = patternExtra[pattern];
+                patternExtra[pattern] = 2 * database->getValue(pattern, tileCells);
+                totalPatternExtra += patternExtra[pattern] - oldExtra;
+            }
+
+            path.push_back(Direction{ static_cast<Direction::Type>(dir) });
+            int result{ search(g + 1, bound, dir) };
+            if (result == found)
+                return found;
+            path.pop_back();
+
+            // Undo move
+            state.moveFrom(oldEmpty);
+            heuristic = oldHeuristic;
+            hash ^= hashDelta;
+            if (pattern >= 0)
+            {
+                tileCells[tile] = from;
+                totalPatternExtra += oldExtra - patternExtra[pattern];
+                patternExtra[pattern] = oldExtra;
+            }
+
+            if (result == pruned)
+            {
+                if (stop && stop->load(std::memory_order_relaxed))
+                    return pruned;
+
+                // Skipped child still has its stored bound (or estimate) to offer
+                learned = std::min(learned, 1 + getChildBound(from, oldEmpty, tile));
+                continue;
+            }
+
+            nextBound = std::min(nextBound, result);
+            learned = std::min(learned, result - g);
+        }
+
+        if (table && learned != std::numeric_limits<int>::max())
+            table->store(hash, generation, g, learned);
+
+        return nextBound;
+    }
+
+    // Lower bound for the board after moving tile from 'from' to 'to', as stored in the table
+    int getChildBound(int from, int to, int tile) const
+    {
+        TranspositionTable::Entry entry{};
+        if (table->probe(hash ^ Zobrist::getMoveDelta<Width, Height>(tile, from, to), generation, entry))
+            return entry.bound;
+        return 0;
+    }
+
+public:
+    // Pattern database is only used for the 4x4 board
+    explicit BasicSolver(const BasicBoard<Width, Height>& board, const PatternDatabase* patterns = nullptr,
+                         TranspositionTable* transpositions = nullptr)
+        : state{ board }
+        , heuristic{ Heuristic::evaluate(state) }
+        , database{ (can_use_patterns && patterns && patterns->isLoaded()) ? patterns : nullptr }
+        , table{ transpositions }
+        , hash{ Zobrist::getHash(state) }
+    {
+        for (int cell{ 0 }; cell < n_cells; ++cell)
+            tileCells[state.getTile(cell)] = cell;
+
+        if (database)
+        {
+            for (int p{ 0 }; p < database->getPatternCount(); ++p)
+            {
+                patternExtra[p] = 2 * database->getValue(p, tileCells);
+                totalPatternExtra += patternExtra[p];
+            }
+        }
+    }
+
+    // Only half of all tile arrangements can reach the completed board
+    bool isSolvable() const
+    {
+        return BoardTables::isSolvable<Width, Height>([this](int cell) { return state.getTile(cell); });
+    }
+
+    // Returns shortest list of moves (as passed to Board::swapExecuted)
+    // that completes the board. Board must be solvable.
+    std::vector<Direction> solve()
+    {
+        assert(isSolvable() && "Board cannot be solved.");
+
+        path.clear();
+        nodesExpanded = 0;
+        const BasicSolver start{ *this };
+
+        int bound{ getEstimate() };
+        while (true)
+        {
+            if (table)
+                generation = table->newGeneration();
+
+            int result{ search(0, bound, -1) };
+            if (result == found)
+                break;
+            bound = result;
+        }
+
+        // Search stops on the completed board, restore the starting state
+        std::vector<Direction> solution{ path };
+        long long nodes{ nodesExpanded };
+        *this = start;
+        nodesExpanded = nodes;
+
+        return solution;
+    }
+
+    // Lower bound on the moves needed from the current board
+    int getEstimate() const { return heuristic.manhattan + std::max(heuristic.conflicts, totalPatternExtra); }
+
+    // One IDA* pass below the current board, continuing a search that has
+    // already made 'depth' moves (the last one lastDir, -1 if none) so that
+    // several solvers can share one search tree. Returns true if the board was
+    // completed within bound: getPath() then holds the moves, and the solver is
+    // left on the completed board. Otherwise nextBound gets the smallest
+    // estimate that went over bound, for the next pass.
+    bool searchPass(int depth, int bound, int lastDir, int& nextBound)
+    {
+        path.clear();
+        if (table)
+            generation = table->newGeneration();
+
+        int result{ search(depth, bound, lastDir) };
+        if (result == found)
+            return true;
+
+        nextBound = (result == pruned) ? std::numeric_limits<int>::max() : result;
+        return false;
+    }
+
+    const std::vector<Direction>& getPath() const { return path; }
+
+    // Abandon any search as soon as *flag is set
+    void setStopFlag(const std::atomic<bool>* flag) { stop = flag; }
+
+    long long getNodesExpanded() const { return nodesExpanded; }
+};
+
+using Solver = BasicSolver<4, 4>;
+
+#endif
@@ -0,0 +1,139 @@
+#ifndef STATE_SPACE_H
+#define STATE_SPACE_H
+
+#include "Direction.h"
+#include "PackedBoard.h"
+#include "PermutationRank.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Breadth-first search over every board reachable from the completed one,
+// for boards small enough to enumerate (up to 12 cells: 3x3, 2x4, 3x4...).
+//
+// The visited set is one bit per PermutationRank (12! ranks take 60MB), set
+// with an atomic OR so that threads can share it. Each frontier is a list of
+// packed board states, so expanding a board needs no unranking. Every layer
+// is split in chunks between the threads, each building its own part of the
+// next layer.
+namespace StateSpace
+{
+    struct Result
+    {
+        std::vector<long long> layerSizes{};    // boards at each distance from the completed board
+        long long states{ 0 };                  // reachable boards (half of all arrangements)
+        int godsNumber{ 0 };                    // largest distance: every board is solved in this many moves
+        std::vector<std::uint64_t> farthest{};  // ranks of the boards at that distance (up to 16)
+    };
+
+    // No board in a Width x Height explore() is this far away
+    constexpr std::uint8_t unreached{ 0xFF };
+
+    template <int Width, int Height>
+    Result explore(int threads, std::vector<std::uint8_t>* distances = nullptr)
+    {
+        static_assert(Width * Height <= 12, "Board has too many states to explore.");
+
+        using Packed = BasicPackedBoard<Width, Height>;
+        constexpr std::uint64_t rank_count{ PermutationRank::getRankCount<Width, Height>() };
+
+        using State = typename Packed::State;
+        constexpr std::size_t chunk_size{ 1 << 12 };
+        constexpr std::size_t max_farthest{ 16 };
+
+        threads = std::max(threads, 1);
+
+        std::size_t words{ static_cast<std::size_t>((rank_count + 63) / 64) };
+        std::unique_ptr<std::atomic<std::uint64_t>[]> visited{ std::make_unique<std::atomic<std::uint64_t>[]>(words) };
+        for (std::size_t word{ 0 }; word < words; ++word)
+            visited[word].store(0, std::memory_order_relaxed);
+
+        if (distances)
+            distances->assign(static_cast<std::size_t>(rank_count), unreached);
+
+        // True if this call set the bit, so each board joins the next layer once
+        auto visit{ [&visited](std::uint64_t rank) {
+            std::uint64_t bit{ std::uint64_t{ 1 } << (rank % 64) };
+            return !(visited[rank / 64].fetch_or(bit, std::memory_order_relaxed) & bit);
+        } };
+
+        std::uint64_t goal{ PermutationRank::getRank(Packed{}) };
+        visit(goal);
+        std::vector<State> frontier{ Packed{}.getState() };
+
+        Result result{};
+        std::vector<std::vector<State>> next(static_cast<std::size_t>(threads));
+
+        for (int depth{ 0 }; !frontier.empty(); ++depth)
+        {
+            result.layerSizes.push_back(static_cast<long long>(frontier.size()));
+            result.states += static_cast<long long>(frontier.size());
+
+            if (distances)
+            {
+                for (State state : frontier)
+                    (*distances)[PermutationRank::getRank(Packed{ state })] = static_cast<std::uint8_t>(depth);
+            }
+
+            std::atomic<std::size_t> nextChunk{ 0 };
+            auto worker{ [&](int thread) {
+                std::vector<State>& found{ next[thread] };
+                found.clear();
+                while (true)
+                {
+                    std::size_t begin{ nextChunk.fetch_add(chunk_size) };
+                    if (begin >= frontier.size())
+                        return;
+                    std::size_t end{ std::min(begin + chunk_size, frontier.size()) };
+
+                    for (std::size_t i{ begin }; i < end; ++i)
+                    {
+                        Packed board{ frontier[i] };
+                        for (int dir{ 0 }; dir < Direction::max_directions; ++dir)
+                        {
+                            Packed child{ board };
+                            if (!child.swapExecuted(static_cast<Direction::Type>(dir)))
+                                continue;
+
+                            if (visit(PermutationRank::getRank(child)))
+                                found.push_back(child.getState());
+                        }
+                    }
+                }
+            } };
+
+            std::vector<std::thread> pool{};
+            for (int t{ 1 }; t < threads; ++t)
+                pool.emplace_back(worker, t);
+            worker(0);
+            for (auto& thread : pool)
+                thread.join();
+
+            std::size_t total{ 0 };
+            for (const auto& part : next)
+                total += part.size();
+
+            if (total == 0)
+            {
+                // Lowest ranks, so the list does not depend on thread timing
+                result.godsNumber = depth;
+                for (State state : frontier)
+                    result.farthest.push_back(PermutationRank::getRank(Packed{ state }));
+                std::sort(result.farthest.begin(), result.farthest.end());
+                result.farthest.resize(std::min(result.farthest.size(), max_farthest));
+            }
+
+            frontier.clear();
+            frontier.reserve(total);
+            for (const auto& part : next)
+                frontier.insert(frontier.end(), part.begin(), part.end());
+        }
+
+        return result;
+    }
+}
+
+#endif
@@ -14,7 +14,7 @@ public:
     Tile() = default;
     explicit Tile(int n) : number{ n }
     {
-        assert(n >= 0 && n < 16 && "Tile number out-of-bounds.");
+        assert(n >= 0 && "Tile number out-of-bounds.");
     }
 
     int getNum() const { return number; }
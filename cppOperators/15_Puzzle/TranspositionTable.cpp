@@ -0,0 +1,92 @@
+#include "TranspositionTable.h"
+#include <algorithm>
+
+namespace
+{
+    constexpr int check_bits{ 32 };
+    constexpr std::uint64_t check_mask{ (std::uint64_t{ 1 } << check_bits) - 1 };
+    constexpr std::uint64_t field_mask{ 0xFF };
+    constexpr std::uint64_t generation_mask{ 0xFFFF };
+
+    // Odd constant, so multiplying mixes the key without losing information
+    constexpr std::uint64_t mix_multiplier{ 0x9E3779B97F4A7C15ull };
+
+    std::uint64_t packEntry(std::uint64_t check, int generation, int g, int bound)
+    {
+        return (check << 32)
+             | (static_cast<std::uint64_t>(generation) << 16)
+             | (static_cast<std::uint64_t>(std::clamp(g, 0, 255)) << 8)
+             | static_cast<std::uint64_t>(std::clamp(bound, 0, 255));
+    }
+}
+
+TranspositionTable::TranspositionTable(int bits)
+    : entries{ std::make_unique<std::atomic<std::uint64_t>[]>(std::size_t{ 1 } << bits) }
+    , indexBits{ bits }
+{
+    clear();
+}
+
+std::uint64_t TranspositionTable::getIndex(Key key) const
+{
+    return (key * mix_multiplier) >> (64 - indexBits);
+}
+
+std::uint64_t TranspositionTable::getCheck(Key key)
+{
+    return (key * mix_multiplier) & check_mask;
+}
+
+void TranspositionTable::clear()
+{
+    // An all-zero word is an empty slot (generation 0 is never handed out)
+    for (std::size_t i{ 0 }; i < (std::size_t{ 1 } << indexBits); ++i)
+        entries[i].store(0, std::memory_order_relaxed);
+    generations.store(0, std::memory_order_relaxed);
+}
+
+int TranspositionTable::newGeneration()
+{
+    // One atomic step, so searches running at once never get the same one
+    while (true)
+    {
+        int generation{ static_cast<int>((generations.fetch_add(1, std::memory_order_relaxed) + 1) & generation_mask) };
+        if (generation != 0)
+            return generation;
+    }
+}
+
+bool TranspositionTable::probe(Key key, int generation, Entry& entry) const
+{
+    std::uint64_t word{ entries[getIndex(key)].load(std::memory_order_relaxed) };
+    if (word == 0 || (word >> 32) != getCheck(key))
+        return false;
+
+    bool current{ static_cast<int>((word >> 16) & generation_mask) == generation };
+    entry.g = current ? static_cast<int>((word >> 8) & field_mask) : unknown_g;
+    entry.bound = static_cast<int>(word & field_mask);
+    return true;
+}
+
+void TranspositionTable::store(Key key, int generation, int g, int bound)
+{
+    std::atomic<std::uint64_t>& slot{ entries[getIndex(key)] };
+    std::uint64_t check{ getCheck(key) };
+
+    std::uint64_t old{ slot.load(std::memory_order_relaxed) };
+    while (true)
+    {
+        int newG{ g };
+        int newBound{ bound };
+        if (old != 0 && (old >> 32) == check)
+        {
+            if (static_cast<int>((old >> 16) & generation_mask) == generation)
+                newG = std::min(newG, static_cast<int>((old >> 8) & field_mask));
+            newBound = std::max(newBound, static_cast<int>(old & field_mask));
+        }
+
+        std::uint64_t updated{ packEntry(check, generation, newG, newBound) };
+        if (updated == old || slot.compare_exchange_weak(old, updated, std::memory_order_relaxed))
+            return;
+    }
+}
@@ -0,0 +1,111 @@
+#ifndef TRANSPOSITION_TABLE_H
+#define TRANSPOSITION_TABLE_H
+
+#include "PackedBoard.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// Zobrist hashing: one fixed random key per (tile, cell); a board's hash is
+// the XOR of the keys of every tile where it stands. A move changes two
+// tiles (the empty one included), so the hash updates with four XORs.
+namespace Zobrist
+{
+    using Hash = std::uint64_t;
+
+    constexpr Hash splitMix64(Hash& seed)
+    {
+        Hash z{ (seed += 0x9E3779B97F4A7C15ull) };
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    template <int Width, int Height>
+    constexpr auto makeKeys()
+    {
+        std::array<std::array<Hash, Width * Height>, Width * Height> keys{};
+        Hash seed{ static_cast<Hash>(Width * 31 + Height) };
+        for (auto& tileKeys : keys)
+        {
+            for (auto& key : tileKeys)
+                key = splitMix64(seed);
+        }
+        return keys;
+    }
+
+    // keys[tile][cell], fixed at compile time so hashes are reproducible
+    template <int Width, int Height>
+    inline constexpr auto keys{ makeKeys<Width, Height>() };
+
+    template <int Width, int Height>
+    Hash getHash(const BasicPackedBoard<Width, Height>& board)
+    {
+        Hash hash{ 0 };
+        for (int cell{ 0 }; cell < Width * Height; ++cell)
+            hash ^= keys<Width, Height>[board.getTile(cell)][cell];
+        return hash;
+    }
+
+    // Hash change when tile moves from one cell into the empty cell 'to'
+    template <int Width, int Height>
+    Hash getMoveDelta(int tile, int from, int to)
+    {
+        const auto& k{ keys<Width, Height> };
+        return k[tile][from] ^ k[tile][to] ^ k[0][to] ^ k[0][from];
+    }
+}
+
+// Fixed-size, lock-free table of search results, keyed by a board hash or
+// PermutationRank. Each entry is a single 64-bit atomic word:
+//   32 bits checking the key | 16 bits generation | 8 bits g | 8 bits bound
+// so readers never see half-written entries and threads can share one table.
+//
+// bound is a lower bound on the moves left to the goal, true whichever search
+// stored it. g is the fewest moves from the start the board has been reached
+// with, which only means something to the search that stored it: each IDA*
+// pass takes its own generation from newGeneration() and sees only the g
+// values stored under it. Colliding keys simply replace each other.
+class TranspositionTable
+{
+public:
+    using Key = std::uint64_t;
+
+    struct Entry
+    {
+        int g{};
+        int bound{};
+    };
+
+    static constexpr int unknown_g{ 255 };
+
+private:
+    std::unique_ptr<std::atomic<std::uint64_t>[]> entries{};
+    int indexBits{};
+    std::atomic<std::uint64_t> generations{ 0 };    // handed out so far
+
+    std::uint64_t getIndex(Key key) const;
+    static std::uint64_t getCheck(Key key);
+
+public:
+    // Table holds 2^indexBits entries (8 bytes each)
+    explicit TranspositionTable(int indexBits = 22);
+
+    // Only while no search is using the table
+    void clear();
+
+    // Generation for one IDA* pass of one search, different from the ones
+    // handed out recently (the 16 bits wrap after 65535 passes)
+    int newGeneration();
+
+    // Returns false if the key is not in the table. entry.g is unknown_g
+    // unless it was stored under this generation.
+    bool probe(Key key, int generation, Entry& entry) const;
+
+    // Merges with an existing entry for the same key (smaller g within the
+    // generation, larger bound always)
+    void store(Key key, int generation, int g, int bound);
+};
+
+#endif
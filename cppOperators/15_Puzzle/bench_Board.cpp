@@ -0,0 +1,194 @@
+#include "Board.h"
+#include "Direction.h"
+#include "../../cppCommon/Random.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// ns/op for the Board operations the game and tests lean on, to judge
+// layout changes against a baseline:
+//   bench_Board [--seed n] [--samples n] [--json <file>]
+// Every benchmark draws its boards and moves from a fixed seed, runs until
+// one sample takes about a millisecond (warm-up), then times the samples
+// and reports the median, 99th percentile and fastest.
+namespace
+{
+    constexpr std::chrono::nanoseconds target_sample{ 1000000 };
+    constexpr int n_warmups{ 3 };
+    constexpr std::size_t pool_size{ 256 };     // boards cycled through, a power of 2
+    constexpr std::size_t n_moves{ 4096 };      // directions cycled through, a power of 2
+
+    // Keeps the compiler from dropping a result nobody reads
+    template <typename T>
+    void keep(const T& value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    // Stream that throws its output away, so operator<< is timed without I/O
+    class NullBuffer : public std::streambuf
+    {
+    protected:
+        int_type overflow(int_type ch) override { return ch; }
+        std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+    };
+
+    struct Result
+    {
+        std::string name{};
+        std::string board{};
+        long long opsPerSample{ 0 };
+        double median{ 0.0 };   // ns per op
+        double p99{ 0.0 };
+        double fastest{ 0.0 };
+    };
+
+    template <typename Op>
+    double timeSample(Op& op, long long ops)
+    {
+        auto start{ std::chrono::steady_clock::now() };
+        for (long long i{ 0 }; i < ops; ++i)
+            op(i);
+        std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start };
+        return elapsed.count();
+    }
+
+    template <typename Op>
+    Result measure(const std::string& name, const std::string& board, int samples, Op op)
+    {
+        // Warm-up: double the batch until it fills a sample, then a few more
+        long long ops{ 1 };
+        while (timeSample(op, ops) < target_sample.count())
+            ops *= 2;
+        for (int warmup{ 0 }; warmup < n_warmups; ++warmup)
+            timeSample(op, ops);
+
+        std::vector<double> times(static_cast<std::size_t>(samples));
+        for (double& time : times)
+            time = timeSample(op, ops) / static_cast<double>(ops);
+        std::sort(times.begin(), times.end());
+
+        std::size_t p99Index{ (times.size() * 99 + 99) / 100 - 1 };
+        return { name, board, ops, times[times.size() / 2], times[p99Index], times.front() };
+    }
+
+    template <int Width, int Height>
+    void benchBoard(std::vector<Result>& results, std::uint64_t seed, int samples)
+    {
+        using BoardType = BasicBoard<Width, Height>;
+        std::string size{ std::to_string(Width) + "x" + std::to_string(Height) };
+
+        Random::Generator gen{ Random::getStream(seed, Width * 16 + Height) };
+        std::vector<BoardType> boards(pool_size);
+        Scrambler::fillRandomBoards(boards.data(), boards.size(), gen);
+        std::vector<BoardType> copies{ boards };
+
+        std::vector<Direction> moves{};
+        for (std::size_t i{ 0 }; i < n_moves; ++i)
+            moves.push_back(Direction{ static_cast<Direction::Type>(Random::get(gen, 0, 3)) });
+
+        BoardType board{ boards[0] };
+        results.push_back(measure("swapExecuted", size, samples, [&](long long i) {
+            keep(board.swapExecuted(moves[static_cast<std::size_t>(i) & (n_moves - 1)]));
+        }));
+
+        results.push_back(measure("getEmptyTileLoc", size, samples, [&](long long i) {
+            keep(boards[static_cast<std::size_t>(i) & (pool_size - 1)].getEmptyTileLoc());
+        }));
+
+        Random::seedThread(seed);
+        results.push_back(measure("randomise", size, samples, [&](long long) {
+            board.randomise();
+            keep(board);
+        }));
+
+        // Equal boards compare every cell; different ones stop at the first mismatch
+        results.push_back(measure("operator== equal", size, samples, [&](long long i) {
+            std::size_t index{ static_cast<std::size_t>(i) & (pool_size - 1) };
+            keep(boards[index] == copies[index]);
+        }));
+        results.push_back(measure("operator== different", size, samples, [&](long long i) {
+            std::size_t index{ static_cast<std::size_t>(i) & (pool_size - 1) };
+            keep(boards[index] == copies[(index + 1) & (pool_size - 1)]);
+        }));
+
+        NullBuffer buffer{};
+        std::ostream out{ &buffer };
+        results.push_back(measure("operator<<", size, samples, [&](long long i) {
+            out << boards[static_cast<std::size_t>(i) & (pool_size - 1)];
+        }));
+    }
+
+    void writeJson(std::ostream& out, const std::vector<Result>& results, std::uint64_t seed, int samples)
+    {
+        out << "{\n  \"seed\": " << seed << ",\n  \"samples\": " << samples << ",\n  \"results\": [\n";
+        for (std::size_t i{ 0 }; i < results.size(); ++i)
+        {
+            const Result& result{ results[i] };
+            out << "    { \"name\": \"" << result.name << "\", \"board\": \"" << result.board
+                << "\", \"ops_per_sample\": " << result.opsPerSample << ", \"median_ns\": " << result.median
+                << ", \"p99_ns\": " << result.p99 << ", \"min_ns\": " << result.fastest << " }"
+                << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        out << "  ]\n}\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    std::uint64_t seed{ 15 };
+    int samples{ 51 };
+    std::string jsonFile{};
+
+    for (int arg{ 1 }; arg < argc; arg += 2)
+    {
+        std::string option{ argv[arg] };
+        if (arg + 1 == argc)
+            option.clear();
+
+        if (option == "--seed")
+            seed = std::stoull(argv[arg + 1]);
+        else if (option == "--samples")
+            samples = std::max(std::stoi(argv[arg + 1]), 1);
+        else if (option == "--json")
+            jsonFile = argv[arg + 1];
+        else
+        {
+            std::cerr << "Usage: bench_Board [--seed n] [--samples n] [--json <file>]\n";
+            return 1;
+        }
+    }
+
+    std::vector<Result> results{};
+    benchBoard<3, 3>(results, seed, samples);
+    benchBoard<4, 4>(results, seed, samples);
+    benchBoard<5, 5>(results, seed, samples);
+    benchBoard<8, 8>(results, seed, samples);
+
+    std::cout << "benchmark              board   median ns     p99 ns     min ns\n";
+    for (const Result& result : results)
+    {
+        std::cout << std::left << std::setw(23) << result.name << std::setw(6) << result.board << std::right
+                  << std::fixed << std::setprecision(2) << std::setw(12) << result.median << std::setw(11)
+                  << result.p99 << std::setw(11) << result.fastest << '\n';
+    }
+
+    if (!jsonFile.empty())
+    {
+        std::ofstream json{ jsonFile };
+        if (!json)
+        {
+            std::cerr << "Cannot write " << jsonFile << '\n';
+            return 1;
+        }
+        writeJson(json, results, seed, samples);
+    }
+
+    return 0;
+}
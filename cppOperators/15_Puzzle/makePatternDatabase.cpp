@@ -0,0 +1,41 @@
+/*  makePatternDatabase.cpp
+ *
+ *  Builds the additive pattern database used by Solver.
+ *
+ *  Usage: makePatternDatabase [663|78] [output file] [threads]
+ *
+ *  6-6-3 takes under a minute and ~60MB of memory; 7-8 takes several
+ *  minutes and ~5GB of memory while building (~280MB file). Re-running after
+ *  an interruption resumes from the last completed layer.
+ */
+
+#include "PatternDatabase.h"
+#include <iostream>
+#include <string>
+#include <thread>
+
+int main(int argc, char* argv[])
+{
+    std::string type{ (argc > 1) ? argv[1] : "663" };
+    std::string filename{ (argc > 2) ? argv[2] : "pdb" + type + ".bin" };
+    int threads{ (argc > 3) ? std::stoi(argv[3]) : static_cast<int>(std::thread::hardware_concurrency()) };
+    if (threads < 1)
+        threads = 1;
+
+    if (type != "663" && type != "78")
+    {
+        std::cerr << "Unknown partition " << type << ", use 663 or 78\n";
+        return 1;
+    }
+
+    const auto& partition{ (type == "78") ? PatternDatabase::getPartition78() : PatternDatabase::getPartition663() };
+
+    if (!PatternDatabase::build(partition, filename, threads))
+    {
+        std::cerr << "Could not write " << filename << '\n';
+        return 1;
+    }
+
+    std::cout << "Pattern database written to " << filename << '\n';
+    return 0;
+}
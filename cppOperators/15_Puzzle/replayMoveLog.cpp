@@ -0,0 +1,100 @@
+/*  replayMoveLog.cpp
+ *
+ *  Checks every game in a move log recorded by 15_Puzzle --record (or
+ *  written with MoveLog): each move must slide a tile and each game should
+ *  end with the board completed. With --show, also plays the games back on
+ *  the console.
+ *
+ *  Usage: replayMoveLog <log file> [--show [frames per second]]
+ *
+ *  Exits with 0 only if every game is legal and solved.
+ */
+
+#include "MoveLog.h"
+#include "Renderer.h"
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Plays each game back, redrawing only the cells that change
+bool showGames(const char* filename, double framesPerSecond)
+{
+    std::ifstream file{ filename, std::ios::binary };
+    std::string error{};
+    if (!MoveLog::readHeader(file, error))
+    {
+        std::cerr << filename << ": " << error << '\n';
+        return false;
+    }
+
+    std::chrono::duration<double> frameTime{ (framesPerSecond > 0.0) ? 1.0 / framesPerSecond : 0.0 };
+    Renderer renderer{ Renderer::diff };
+    MoveLog game{};
+    while (game.read(file, error))
+    {
+        PackedBoard board{ game.getStart() };
+        renderer.invalidate();
+        renderer.draw(board);
+        for (std::size_t index{ 0 }; index < game.size(); ++index)
+        {
+            if (!board.swapExecuted(game.getMove(index)))
+                break;
+            renderer.draw(board);
+            std::this_thread::sleep_for(frameTime);
+        }
+    }
+
+    if (!error.empty())
+    {
+        std::cerr << filename << ": " << error << '\n';
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <log file> [--show [frames per second]]\n";
+        return 1;
+    }
+
+    std::ifstream file{ argv[1], std::ios::binary };
+    if (!file)
+    {
+        std::cerr << "Could not open " << argv[1] << '\n';
+        return 1;
+    }
+    std::vector<std::uint8_t> data{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+
+    if (argc > 2 && std::string{ argv[2] } == "--show")
+    {
+        if (!showGames(argv[1], (argc > 3) ? std::stod(argv[3]) : 20.0))
+            return 1;
+    }
+
+    MoveLog::Summary summary{};
+    std::string error{};
+    auto start{ std::chrono::steady_clock::now() };
+    bool valid{ MoveLog::verify(data.data(), data.size(), summary, error) };
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+    if (!valid)
+    {
+        std::cerr << argv[1] << ": " << error << '\n';
+        return 1;
+    }
+
+    std::cout << summary.games << " games, " << summary.moves << " moves: " << summary.solved << " solved, "
+              << summary.unsolved << " unsolved, " << summary.illegal << " with illegal moves\n";
+    std::cout << "Checked in " << elapsed.count() * 1000.0 << " ms, "
+              << summary.moves / elapsed.count() << " moves/s\n";
+
+    return (summary.solved == summary.games) ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+#include "BatchSolver.h"
+#include "Board.h"
+#include "../../cppCommon/Random.h"
+#include "Solver.h"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+Board randomWalk(int moves)
+{
+    // Random walk that never undoes its last move
+    Board board{};
+    int last{ -1 };
+    for (int move{ 0 }; move < moves; ++move)
+    {
+        int dir{ Random::get(0, 3) };
+        if ((dir ^ 1) != last && board.swapExecuted(Direction{ static_cast<Direction::Type>(dir) }))
+            last = dir;
+    }
+    return board;
+}
+
+bool solvesAll(const std::vector<Board>& boards, int threads, long long splitNodes)
+{
+    BatchSolver batch{ threads };
+    batch.setSplitNodes(splitNodes);
+
+    std::vector<int> lengths(boards.size(), -1);
+    bool movesWork{ true };
+    batch.solve(boards, [&](const BatchSolver::Result& result)
+    {
+        lengths[result.instance] = result.length;
+
+        Board board{ boards[result.instance] };
+        for (const auto& dir : result.moves)
+            board.swapExecuted(dir);
+        if (!(board == Board{}))
+            movesWork = false;
+    });
+
+    // Same optimal lengths as solving one at a time
+    for (std::size_t index{ 0 }; index < boards.size(); ++index)
+    {
+        if (lengths[index] != static_cast<int>(Solver{ boards[index] }.solve().size()))
+            return false;
+    }
+    return movesWork;
+}
+
+int main()
+{
+    std::cout << std::boolalpha;
+
+    // Reading boards: comments and blank lines skipped
+    std::istringstream good{ "# two boards\n"
+                             "1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 0\n"
+                             "\n"
+                             "1 2 3 4 5 6 7 8 9 10 11 12 13 14 0 15\n" };
+    std::vector<Board> boards{};
+    std::string error{};
+    std::cout << (BatchSolver::readBoards(good, boards, error) && boards.size() == 2) << '\n';
+
+    // Too few numbers, repeated tile, unsolvable board
+    std::istringstream shortLine{ "1 2 3\n" };
+    std::istringstream repeated{ "1 1 3 4 5 6 7 8 9 10 11 12 13 14 15 0\n" };
+    std::istringstream unsolvable{ "2 1 3 4 5 6 7 8 9 10 11 12 13 14 15 0\n" };
+    std::cout << !BatchSolver::readBoards(shortLine, boards, error) << ' '
+              << !BatchSolver::readBoards(repeated, boards, error) << ' '
+              << !BatchSolver::readBoards(unsolvable, boards, error) << '\n';
+
+    std::vector<Board> batch{};
+    for (int count{ 0 }; count < 20; ++count)
+        batch.push_back(randomWalk(80));
+
+    // One thread, several threads, and several threads splitting every board
+    std::cout << solvesAll(batch, 1, BatchSolver::default_split_nodes) << '\n';
+    std::cout << solvesAll(batch, 4, BatchSolver::default_split_nodes) << '\n';
+    std::cout << solvesAll(batch, 4, 0) << '\n';
+
+    return 0;
+}
@@ -0,0 +1,57 @@
+#include "Board.h"
+#include "PackedBoard.h"
+#include "Solver.h"
+#include <iostream>
+
+// Scramble a Width x Height board with random moves, solve it and check the
+// solution completes the board
+template <int Width, int Height>
+void testSize(int scrambleMoves)
+{
+    BasicBoard<Width, Height> board{};
+    for (int count{ 0 }; count < scrambleMoves; ++count)
+        board.swapExecuted(Direction::getRandomDirection());
+
+    BasicPackedBoard<Width, Height> packed{ board };
+    BasicSolver<Width, Height> solver{ board };
+    auto moves{ solver.solve() };
+
+    for (const auto& dir : moves)
+    {
+        board.swapExecuted(dir);
+        packed.swapExecuted(dir);
+    }
+
+    std::cout << Width << 'x' << Height << ": " << moves.size() << " moves, "
+              << (board == BasicBoard<Width, Height>{}) << ' ' << packed.isComplete() << '\n';
+}
+
+int main()
+{
+    std::cout << std::boolalpha;
+
+    testSize<3, 3>(1000);
+    testSize<2, 4>(1000);
+    testSize<4, 2>(1000);
+    testSize<4, 4>(60);
+    testSize<2, 8>(40);
+    testSize<5, 5>(40);
+
+    // Neighbour table agrees with Point::getAdjacentPoint on every cell
+    bool tablesMatch{ true };
+    for (int cell{ 0 }; cell < 5 * 3; ++cell)
+    {
+        Point pt{ cell % 5, cell / 5 };
+        for (int dir{ 0 }; dir < Direction::max_directions; ++dir)
+        {
+            Point next{ pt.getAdjacentPoint(static_cast<Direction::Type>(dir)) };
+            int expected{ BasicBoard<5, 3>::isValidSwap(next) ? next.y * 5 + next.x : BoardTables::no_cell };
+            bool legal{ (BoardTables::legalMoves<5, 3>[cell] & (1u << dir)) != 0 };
+            if (BoardTables::neighbours<5, 3>[cell][dir] != expected || legal != (expected != BoardTables::no_cell))
+                tablesMatch = false;
+        }
+    }
+    std::cout << tablesMatch << '\n';
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include "Board.h"
+#include "Heuristic.h"
+#include "PackedBoard.h"
+#include "Scrambler.h"
+#include "Solver.h"
+#include "../../cppCommon/Random.h"
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+    constexpr Heuristic::Kernel kernels[]{ Heuristic::Kernel::scalar, Heuristic::Kernel::sse41, Heuristic::Kernel::avx2 };
+
+    // Every estimate change from applyMove() matches a full evaluation
+    template <int Width, int Height>
+    bool checkWalk(int moves, Random::Generator& gen)
+    {
+        BasicPackedBoard<Width, Height> board{};
+        Heuristic::Estimate<Width, Height> estimate{ Heuristic::evaluate(board) };
+        for (int move{ 0 }; move < moves; ++move)
+        {
+            int to{ board.getEmptyCell() };
+            BasicPackedBoard<Width, Height> next{ board };
+            if (!next.swapExecuted(static_cast<Direction::Type>(Random::get(gen, 0, 3))))
+                continue;
+
+            int from{ next.getEmptyCell() };
+            int delta{ Heuristic::applyMove(estimate, board.getTile(from), from, to) };
+            Heuristic::Estimate<Width, Height> full{ Heuristic::evaluate(next) };
+            if (delta != full.total() - Heuristic::evaluate(board).total() || estimate.manhattan != full.manhattan
+                || estimate.conflicts != full.conflicts)
+                return false;
+            board = next;
+        }
+        return true;
+    }
+}
+
+int main()
+{
+    std::cout << std::boolalpha;
+    Random::Generator gen{ Random::getStream(19, 0) };
+
+    constexpr std::size_t n_boards{ 100000 };
+    std::vector<Board> boards(n_boards);
+    Scrambler::fillRandomBoards(boards.data(), n_boards, gen);
+
+    std::vector<PackedBoard::State> states(n_boards);
+    for (std::size_t i{ 0 }; i < n_boards; ++i)
+        states[i] = PackedBoard{ boards[i] }.getState();
+
+    // Completed board: nothing to do
+    std::cout << (Heuristic::getEstimate(PackedBoard{}.getState()) == 0) << '\n';
+
+    // Single-board kernels agree with the scalar evaluation and with Solver
+    bool agree{ true };
+    for (std::size_t i{ 0 }; i < n_boards; ++i)
+    {
+        Heuristic::Estimate<4, 4> reference{ Heuristic::evaluate(PackedBoard{ states[i] }) };
+        if (Heuristic::getManhattan(states[i]) != reference.manhattan
+            || Heuristic::getLinearConflicts(states[i]) != reference.conflicts
+            || Heuristic::getEstimate(states[i]) != reference.total()
+            || (i % 100 == 0 && Solver{ boards[i] }.getEstimate() != reference.total()))
+            agree = false;
+    }
+    std::cout << agree << '\n';
+
+    // Batches give the same answers with every kernel, odd counts included
+    std::vector<int> expected(n_boards);
+    for (std::size_t i{ 0 }; i < n_boards; ++i)
+        expected[i] = Heuristic::evaluate(PackedBoard{ states[i] }).total();
+
+    bool batches{ true };
+    for (Heuristic::Kernel kernel : kernels)
+    {
+        std::vector<int> estimates(n_boards, -1);
+        Heuristic::getEstimates(states.data(), estimates.data(), n_boards - 1, kernel);
+        estimates.back() = expected.back();
+        batches = batches && (estimates == expected);
+    }
+    std::cout << batches << '\n';
+
+    // O(1) updates match full evaluations on several board sizes
+    std::cout << checkWalk<4, 4>(10000, gen) << ' ' << checkWalk<3, 3>(10000, gen) << ' '
+              << checkWalk<5, 3>(10000, gen) << '\n';
+
+    // Throughput of each kernel
+    std::vector<int> estimates(n_boards);
+    const char* names[]{ "scalar", "SSE4.1", "AVX2" };
+    for (Heuristic::Kernel kernel : kernels)
+    {
+        if (static_cast<int>(kernel) > static_cast<int>(Heuristic::getKernel()))
+            continue;
+
+        constexpr int n_rounds{ 20 };
+        auto start{ std::chrono::steady_clock::now() };
+        for (int round{ 0 }; round < n_rounds; ++round)
+            Heuristic::getEstimates(states.data(), estimates.data(), n_boards, kernel);
+        std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+        std::cout << names[static_cast<int>(kernel)] << ": "
+                  << elapsed.count() * 1e9 / (n_rounds * n_boards) << " ns per board\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+#include "Board.h"
+#include "MoveLog.h"
+#include "PackedBoard.h"
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Game that ends solved: a random walk away from the completed board,
+// played back the other way
+MoveLog makeSolvedGame(int length)
+{
+    PackedBoard board{};
+    std::vector<Direction> walk{};
+    while (static_cast<int>(walk.size()) < length)
+    {
+        Direction dir{ Direction::getRandomDirection() };
+        if (board.swapExecuted(dir))
+            walk.push_back(dir);
+    }
+
+    MoveLog game{ board.toBoard() };
+    for (auto it{ walk.rbegin() }; it != walk.rend(); ++it)
+        game.record(-*it);
+    return game;
+}
+
+std::vector<std::uint8_t> toBytes(const std::string& text)
+{
+    return std::vector<std::uint8_t>(text.begin(), text.end());
+}
+
+int main()
+{
+    std::cout << std::boolalpha;
+
+    // Moves are stored 2 bits each and read back in order
+    MoveLog game{ makeSolvedGame(50) };
+    std::ostringstream one{};
+    game.write(one);
+    Board board{};
+    std::cout << (game.size() == 50 && one.str().size() == 25 && game.replay(board) && board == Board{}) << '\n';
+
+    // Games survive a write and read
+    std::ostringstream out{};
+    MoveLog::writeHeader(out);
+    std::vector<MoveLog> games{};
+    for (int length{ 0 }; length < 20; ++length)
+    {
+        games.push_back(makeSolvedGame(length * 7));
+        games.back().write(out);
+    }
+    MoveLog unfinished{ Board{} };
+    unfinished.record(Direction::up);
+    unfinished.write(out);
+
+    std::istringstream in{ out.str() };
+    std::string error{};
+    bool same{ MoveLog::readHeader(in, error) };
+    MoveLog read{};
+    for (const auto& original : games)
+    {
+        if (!read.read(in, error) || read.getStart() != original.getStart() || read.size() != original.size())
+        {
+            same = false;
+            continue;
+        }
+        for (std::size_t index{ 0 }; index < read.size(); ++index)
+        {
+            if (read.getMove(index).getDirection() != original.getMove(index).getDirection())
+                same = false;
+        }
+    }
+    std::cout << (same && read.read(in, error) && !read.read(in, error) && error.empty()) << '\n';
+
+    // Verify counts solved and unsolved games
+    std::vector<std::uint8_t> bytes{ toBytes(out.str()) };
+    MoveLog::Summary summary{};
+    std::cout << (MoveLog::verify(bytes.data(), bytes.size(), summary, error) && summary.games == 21
+                  && summary.solved == 20 && summary.unsolved == 1 && summary.illegal == 0) << '\n';
+
+    // A move into the edge is caught, and so is a cut-off log
+    std::ostringstream bad{};
+    MoveLog::writeHeader(bad);
+    MoveLog illegal{ Board{} };
+    illegal.record(Direction::down);
+    illegal.write(bad);
+    bytes = toBytes(bad.str());
+    summary = MoveLog::Summary{};
+    std::cout << (MoveLog::verify(bytes.data(), bytes.size(), summary, error) && summary.illegal == 1) << ' '
+              << !MoveLog::verify(bytes.data(), bytes.size() - 1, summary, error) << ' '
+              << !MoveLog::verify(bytes.data() + 1, bytes.size() - 1, summary, error) << '\n';
+
+    // Verifying a big log, and its size against a text log of the same games
+    std::ostringstream big{};
+    MoveLog::writeHeader(big);
+    std::ostringstream text{};
+    constexpr int n_games{ 20000 };
+    for (int count{ 0 }; count < n_games; ++count)
+    {
+        MoveLog solved{ makeSolvedGame(200) };
+        solved.write(big);
+
+        Board start{ solved.getStart().toBoard() };
+        for (int y{ 0 }; y < Board::getHeight(); ++y)
+        {
+            for (int x{ 0 }; x < Board::getWidth(); ++x)
+                text << start.getTile(Point{ x, y }).getNum() << ' ';
+        }
+        for (std::size_t index{ 0 }; index < solved.size(); ++index)
+            text << solved.getMove(index) << ' ';
+        text << '\n';
+    }
+    bytes = toBytes(big.str());
+    summary = MoveLog::Summary{};
+    auto start{ std::chrono::steady_clock::now() };
+    bool valid{ MoveLog::verify(bytes.data(), bytes.size(), summary, error) };
+    std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+    std::cout << (valid && summary.solved == n_games) << '\n';
+    std::cout << "Binary " << bytes.size() << " bytes, text " << text.str().size() << " bytes; "
+              << summary.moves / elapsed.count() << " moves/s\n";
+
+    return 0;
+}
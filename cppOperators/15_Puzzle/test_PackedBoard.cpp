@@ -0,0 +1,35 @@
+#include "Board.h"
+#include "PackedBoard.h"
+#include <iostream>
+
+int main()
+{
+    std::cout << std::boolalpha;
+
+    // Completed boards match
+    std::cout << (PackedBoard{ Board{} } == PackedBoard{}) << '\n';
+    std::cout << PackedBoard{}.isComplete() << ' ' << (PackedBoard{}.getEmptyCell() == 15) << '\n';
+    std::cout << (PackedBoard{}.toBoard() == Board{}) << '\n';
+
+    // Moves agree with Board::swapExecuted, including invalid ones
+    Board board{};
+    PackedBoard packed{};
+    bool allMatch{ true };
+    for (int count{ 0 }; count < 1000; ++count)
+    {
+        Direction dir{ Direction::getRandomDirection() };
+        if (board.swapExecuted(dir) != packed.swapExecuted(dir))
+            allMatch = false;
+        if (!(packed.toBoard() == board) || PackedBoard{ board } != packed)
+            allMatch = false;
+    }
+    std::cout << allMatch << '\n';
+
+    // Empty tile is recovered from a raw state word
+    std::cout << (PackedBoard{ packed.getState() }.getEmptyCell() == packed.getEmptyCell()) << '\n';
+
+    // Scrambled board round-trips through the raw state word
+    std::cout << (PackedBoard{ packed.getState() }.toBoard() == board) << '\n';
+
+    return 0;
+}
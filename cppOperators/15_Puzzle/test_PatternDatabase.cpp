@@ -0,0 +1,48 @@
+#include "Board.h"
+#include "PackedBoard.h"
+#include "PatternDatabase.h"
+#include "Solver.h"
+#include <cstdio>
+#include <iostream>
+
+int main()
+{
+    // Small partition of 3-tile patterns builds in a second or two
+    const PatternDatabase::Partition partition{
+        { 1, 2, 3 }, { 4, 7, 8 }, { 5, 6, 9 }, { 10, 13, 14 }, { 11, 12, 15 }
+    };
+    const char* filename{ "test_pdb.bin" };
+
+    std::cout << std::boolalpha;
+    std::cout << PatternDatabase::build(partition, filename, 2) << '\n';
+
+    PatternDatabase database{ filename };
+    std::cout << database.isLoaded() << ' ' << (database.getPatternCount() == 5) << '\n';
+
+    // Completed board needs no moves
+    std::cout << (database.getHeuristic(PackedBoard{}) == 0) << '\n';
+
+    // Missing file is reported, not fatal
+    std::cout << !PatternDatabase{ "no_such_file.bin" }.isLoaded() << '\n';
+
+    // Estimate never exceeds the optimal length, and solutions match plain IDA*
+    for (int count{ 0 }; count < 5; ++count)
+    {
+        Board board{};
+        for (int move{ 0 }; move < 40; ++move)
+            board.swapExecuted(Direction::getRandomDirection());
+
+        Solver plain{ board };
+        Solver withPatterns{ board, &database };
+        auto expected{ plain.solve() };
+        auto actual{ withPatterns.solve() };
+
+        std::cout << (database.getHeuristic(PackedBoard{ board }) <= static_cast<int>(expected.size())) << ' '
+                  << (actual.size() == expected.size()) << ' '
+                  << (withPatterns.getNodesExpanded() <= plain.getNodesExpanded()) << '\n';
+    }
+
+    std::remove(filename);
+
+    return 0;
+}
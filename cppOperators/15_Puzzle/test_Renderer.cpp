@@ -0,0 +1,106 @@
+#include "Board.h"
+#include "PackedBoard.h"
+#include "Renderer.h"
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// Frame as operator<< used to print it: one stream write per character group
+std::string streamFrame(const Board& board)
+{
+    std::ostringstream out{};
+    for (int line{ 0 }; line < g_consoleLines; ++line)
+        out << '\n';
+    for (int y{ 0 }; y < Board::getHeight(); ++y)
+    {
+        for (int x{ 0 }; x < Board::getWidth(); ++x)
+            out << board.getTile(Point{ x, y });
+        out << '\n';
+    }
+    return out.str();
+}
+
+int countOf(std::string_view text, char c)
+{
+    int count{ 0 };
+    for (char ch : text)
+        count += (ch == c);
+    return count;
+}
+
+int main()
+{
+    std::cout << std::boolalpha;
+
+    // Scroll mode and operator<< print exactly what the old stream code did
+    Renderer scroll{ Renderer::scroll };
+    bool same{ true };
+    for (int count{ 0 }; count < 100; ++count)
+    {
+        Board board{};
+        board.randomise();
+        std::ostringstream printed{};
+        printed << board;
+        if (scroll.render(board) != streamFrame(board) || printed.str() != streamFrame(board))
+            same = false;
+    }
+    std::cout << same << '\n';
+
+    // Cursor-home frames start at the top left and clear what is below
+    Board board{};
+    Renderer home{ Renderer::cursorHome };
+    std::string_view frame{ home.render(board) };
+    std::cout << (frame.substr(0, 3) == "\x1b[H" && frame.substr(frame.size() - 3) == "\x1b[J"
+                  && countOf(frame, '\n') == Board::getHeight()) << '\n';
+
+    // Diff mode: full first frame, then only the two cells a move changes
+    Renderer diff{ Renderer::diff };
+    std::string first{ diff.render(board) };
+    board.swapExecuted(Direction{ Direction::up });
+    std::string_view moved{ diff.render(board) };
+    std::cout << (first == std::string{ home.render(Board{}) } && countOf(moved, 'H') == 3
+                  && moved.find("\x1b[3;13H    ") != std::string_view::npos
+                  && moved.find("\x1b[4;13H 12 ") != std::string_view::npos) << '\n';
+    std::cout << (countOf(diff.render(board), 'H') == 1) << '\n';
+    diff.invalidate();
+    std::cout << (diff.render(board) == home.render(board)) << '\n';
+
+    // PackedBoard renders the same as Board, other sizes work too
+    board.randomise();
+    std::string fromBoard{ scroll.render(board) };
+    std::cout << (scroll.render(PackedBoard{ board }) == fromBoard) << ' '
+              << (BasicRenderer<3, 3>{ BasicRenderer<3, 3>::cursorHome }.render(BasicBoard<3, 3>{})
+                  == "\x1b[H  1   2   3 \n  4   5   6 \n  7   8     \n\x1b[J") << '\n';
+
+    // Frames per second: stream formatting against the renderer
+    constexpr int frames{ 200000 };
+    std::FILE* null{ std::fopen("/dev/null", "w") };
+    Board replay{};
+    long long bytes{ 0 };
+
+    auto start{ std::chrono::steady_clock::now() };
+    for (int i{ 0 }; i < frames; ++i)
+    {
+        replay.swapExecuted(Direction::getRandomDirection());
+        std::string text{ streamFrame(replay) };
+        bytes += static_cast<long long>(std::fwrite(text.data(), 1, text.size(), null));
+    }
+    std::chrono::duration<double> streamed{ std::chrono::steady_clock::now() - start };
+
+    Renderer fast{ Renderer::diff };
+    start = std::chrono::steady_clock::now();
+    for (int i{ 0 }; i < frames; ++i)
+    {
+        replay.swapExecuted(Direction::getRandomDirection());
+        fast.draw(replay, null);
+    }
+    std::chrono::duration<double> rendered{ std::chrono::steady_clock::now() - start };
+    std::fclose(null);
+
+    std::cout << "Stream: " << frames / streamed.count() << " frames/s, renderer (diff): "
+              << frames / rendered.count() << " frames/s (" << bytes % 2 << ")\n";
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include "Board.h"
+#include "../../cppCommon/Random.h"
+#include "Scrambler.h"
+#include "Solver.h"
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <vector>
+
+int main()
+{
+    std::cout << std::boolalpha;
+
+    // Every scrambled board can be solved
+    std::vector<Board> boards(100000);
+    auto start{ std::chrono::steady_clock::now() };
+    Scrambler::fillRandomBoards(boards.data(), boards.size());
+    std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start };
+
+    bool allSolvable{ true };
+    for (const auto& board : boards)
+    {
+        if (!Solver{ board }.isSolvable())
+            allSolvable = false;
+    }
+    std::cout << allSolvable << '\n';
+    std::cout << elapsed.count() / boards.size() << " ns per board\n";
+
+    // 3x2 board has 6!/2 = 360 solvable states: each should turn up about
+    // equally often (expect roughly 1000 +/- 100 each)
+    using SmallBoard = BasicBoard<3, 2>;
+    std::map<std::vector<int>, int> counts{};
+    SmallBoard::TileList tiles{};
+    for (int count{ 0 }; count < 360000; ++count)
+    {
+        Scrambler::scramble<3, 2>(tiles, Random::getGenerator());
+        std::vector<int> key{};
+        for (const auto& tile : tiles)
+            key.push_back(tile.getNum());
+        ++counts[key];
+    }
+
+    int fewest{ counts.begin()->second };
+    int most{ fewest };
+    for (const auto& [key, count] : counts)
+    {
+        fewest = std::min(fewest, count);
+        most = std::max(most, count);
+    }
+    std::cout << (counts.size() == 360) << ' ' << (fewest > 800) << ' ' << (most < 1200) << '\n';
+
+    // randomise() goes through the scrambler too
+    Board board{};
+    board.randomise();
+    std::cout << Solver{ board }.isSolvable() << '\n';
+
+    return 0;
+}
@@ -0,0 +1,53 @@
+#include "Board.h"
+#include "../../cppCommon/Random.h"
+#include "Solver.h"
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+// Solution completes the board in the optimal number of moves
+bool solvesBoard(Board board, std::size_t optimal)
+{
+    Solver solver{ board };
+
+    auto start{ std::chrono::steady_clock::now() };
+    std::vector<Direction> moves{ solver.solve() };
+    std::chrono::duration<double, std::milli> elapsed{ std::chrono::steady_clock::now() - start };
+
+    for (const auto& dir : moves)
+        board.swapExecuted(dir);
+
+    std::cout << "Solved in " << moves.size() << " moves, " << solver.getNodesExpanded()
+              << " nodes, " << elapsed.count() << " ms\n";
+
+    return board == Board{} && moves.size() == optimal;
+}
+
+int main()
+{
+    std::cout << std::boolalpha;
+
+    // Already complete
+    std::cout << solvesBoard(Board{}, 0) << '\n';
+
+    // Known short scramble: optimal solution is the reverse
+    Board board{};
+    board.swapExecuted(Direction::up);
+    board.swapExecuted(Direction::left);
+    board.swapExecuted(Direction::up);
+    std::cout << (Solver{ board }.solve().size() == 3) << '\n';
+
+    // Random scrambles, from a fixed seed so the boards (and the time taken)
+    // are the same every run; their optimal lengths are known. Without a
+    // pattern database the 57-move board takes over a second.
+    Random::seedThread(4);
+    for (std::size_t optimal : { 48, 55, 57, 54, 59 })
+    {
+        Board random{};
+        random.randomise();
+        std::cout << Solver{ random }.isSolvable() << ' ' << solvesBoard(random, optimal) << '\n';
+    }
+
+    return 0;
+}
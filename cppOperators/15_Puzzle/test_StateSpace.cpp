@@ -0,0 +1,52 @@
+#include "Board.h"
+#include "PackedBoard.h"
+#include "PermutationRank.h"
+#include "Solver.h"
+#include "StateSpace.h"
+#include <iostream>
+#include <vector>
+
+int main()
+{
+    std::cout << std::boolalpha;
+
+    // Known results: half of all arrangements reachable, God's numbers 21, 36 and 31
+    StateSpace::Result small{ StateSpace::explore<2, 3>(1) };
+    StateSpace::Result wide{ StateSpace::explore<2, 4>(3) };
+    std::cout << (small.states == 360 && small.godsNumber == 21) << ' '
+              << (wide.states == 20160 && wide.godsNumber == 36 && wide.layerSizes.back() == 1) << '\n';
+
+    std::vector<std::uint8_t> distances{};
+    StateSpace::Result eight{ StateSpace::explore<3, 3>(4, &distances) };
+    std::cout << (eight.states == 181440 && eight.godsNumber == 31 && eight.farthest.size() == 2
+                  && eight.layerSizes[1] == 2 && eight.layerSizes[2] == 4) << '\n';
+
+    // Same answer whatever the number of threads
+    StateSpace::Result single{ StateSpace::explore<3, 3>(1) };
+    std::cout << (single.layerSizes == eight.layerSizes && single.farthest == eight.farthest) << '\n';
+
+    // Distances table: every reachable board gets one, the rest stay unreached
+    long long reached{ 0 };
+    for (std::uint8_t distance : distances)
+        reached += (distance != StateSpace::unreached);
+    std::cout << (reached == eight.states && distances[PermutationRank::getRank(BasicPackedBoard<3, 3>{})] == 0) << '\n';
+
+    // Solver's estimate never overestimates, and its solutions are exactly as long
+    bool admissible{ true };
+    bool optimal{ true };
+    for (std::uint64_t rank{ 0 }; rank < distances.size(); ++rank)
+    {
+        if (distances[rank] == StateSpace::unreached)
+            continue;
+
+        BasicBoard<3, 3> board{ PermutationRank::getBoard<3, 3>(rank).toBoard() };
+        BasicSolver<3, 3> solver{ board };
+        if (solver.getEstimate() > distances[rank])
+            admissible = false;
+        if (rank % 997 == 0 && static_cast<int>(solver.solve().size()) != distances[rank])
+            optimal = false;
+    }
+    std::cout << admissible << ' ' << optimal << '\n';
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+#include "Board.h"
+#include "PackedBoard.h"
+#include "PermutationRank.h"
+#include "../../cppCommon/Random.h"
+#include "Scrambler.h"
+#include "Solver.h"
+#include "StateSpace.h"
+#include "TranspositionTable.h"
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Solves random reachable boards, all through one small table
+    template <int Width, int Height>
+    bool sharedTableIsOptimal(Random::Generator& gen)
+    {
+        std::vector<std::uint8_t> distances{};
+        StateSpace::explore<Width, Height>(1, &distances);
+
+        TranspositionTable shared{ 16 };
+        bool optimal{ true };
+        for (int solved{ 0 }; solved < 2000;)
+        {
+            std::uint64_t rank{ static_cast<std::uint64_t>(Random::get(gen, 0, static_cast<int>(distances.size()) - 1)) };
+            if (distances[rank] == StateSpace::unreached)
+                continue;
+
+            BasicBoard<Width, Height> board{ PermutationRank::getBoard<Width, Height>(rank).toBoard() };
+            BasicSolver<Width, Height> solver{ board, nullptr, &shared };
+            std::vector<Direction> moves{ solver.solve() };
+            for (const auto& dir : moves)
+                board.swapExecuted(dir);
+            if (static_cast<int>(moves.size()) != distances[rank] || !(board == BasicBoard<Width, Height>{}))
+                optimal = false;
+            ++solved;
+        }
+        return optimal;
+    }
+
+    // Several threads solving at once through one small table
+    bool threadsShareTable()
+    {
+        std::vector<std::uint8_t> distances{};
+        StateSpace::explore<3, 3>(1, &distances);
+
+        constexpr int n_threads{ 4 };
+        TranspositionTable shared{ 12 };
+        std::vector<int> wrong(n_threads);
+        std::vector<std::thread> threads{};
+        for (int t{ 0 }; t < n_threads; ++t)
+        {
+            threads.emplace_back([&distances, &shared, &wrong, t]() {
+                Random::Generator gen{ Random::getStream(6, 1 + t) };
+                for (int solved{ 0 }; solved < 3000;)
+                {
+                    std::uint64_t rank{ static_cast<std::uint64_t>(Random::get(gen, 0, static_cast<int>(distances.size()) - 1)) };
+                    if (distances[rank] == StateSpace::unreached)
+                        continue;
+
+                    BasicBoard<3, 3> board{ PermutationRank::getBoard<3, 3>(rank).toBoard() };
+                    BasicSolver<3, 3> solver{ board, nullptr, &shared };
+                    std::vector<Direction> moves{ solver.solve() };
+                    for (const auto& dir : moves)
+                        board.swapExecuted(dir);
+                    if (static_cast<int>(moves.size()) != distances[rank] || !(board == BasicBoard<3, 3>{}))
+                        ++wrong[t];
+                    ++solved;
+                }
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        for (int count : wrong)
+        {
+            if (count != 0)
+                return false;
+        }
+        return true;
+    }
+}
+
+int main()
+{
+    std::cout << std::boolalpha;
+
+    // Every 3x3 arrangement gets its own rank, and unranks back to itself
+    using SmallPacked = BasicPackedBoard<3, 3>;
+    constexpr auto smallCount{ PermutationRank::getRankCount<3, 3>() };
+    std::vector<bool> seen(smallCount);
+    bool roundTrip{ true };
+    for (PermutationRank::Rank rank{ 0 }; rank < smallCount; ++rank)
+    {
+        SmallPacked board{ PermutationRank::getBoard<3, 3>(rank) };
+        PermutationRank::Rank again{ PermutationRank::getRank(board) };
+        if (again != rank || seen[again])
+            roundTrip = false;
+        seen[again] = true;
+    }
+    std::cout << roundTrip << '\n';
+
+    // Completed 4x4 board (20-digit Lehmer code) round-trips
+    PackedBoard complete{};
+    std::cout << (PermutationRank::getBoard<4, 4>(PermutationRank::getRank(complete)) == complete) << '\n';
+
+    // Random 4x4 boards round-trip too
+    bool bigRoundTrip{ true };
+    for (int count{ 0 }; count < 10000; ++count)
+    {
+        Board board{};
+        board.randomise();
+        PackedBoard packed{ board };
+        if (PermutationRank::getBoard<4, 4>(PermutationRank::getRank(packed)) != packed)
+            bigRoundTrip = false;
+    }
+    std::cout << bigRoundTrip << '\n';
+
+    // Incremental Zobrist hash matches hashing from scratch
+    PackedBoard moving{};
+    Zobrist::Hash hash{ Zobrist::getHash(moving) };
+    bool hashMatches{ true };
+    for (int count{ 0 }; count < 1000; ++count)
+    {
+        int empty{ moving.getEmptyCell() };
+        int from{ PackedBoard::getNeighbour(empty, Direction{ static_cast<Direction::Type>(Random::get(0, 3)) }) };
+        if (from == PackedBoard::no_cell)
+            continue;
+        hash ^= Zobrist::getMoveDelta<4, 4>(moving.getTile(from), from, empty);
+        moving.moveFrom(from);
+        if (hash != Zobrist::getHash(moving))
+            hashMatches = false;
+    }
+    std::cout << hashMatches << '\n';
+
+    // Store and probe: g merges to the minimum, bound to the maximum
+    TranspositionTable table{ 10 };
+    int first{ table.newGeneration() };
+    TranspositionTable::Entry entry{};
+    std::cout << !table.probe(12345, first, entry) << '\n';
+    table.store(12345, first, 7, 20);
+    table.store(12345, first, 9, 18);
+    std::cout << (table.probe(12345, first, entry) && entry.g == 7 && entry.bound == 20) << '\n';
+
+    // Another generation sees the bound but not the g
+    int second{ table.newGeneration() };
+    std::cout << (second != first && table.probe(12345, second, entry) && entry.g == TranspositionTable::unknown_g
+                  && entry.bound == 20) << '\n';
+
+    // Its own g replaces the other one's, and the first no longer sees a g
+    table.store(12345, second, 30, 5);
+    std::cout << (table.probe(12345, second, entry) && entry.g == 30 && entry.bound == 20
+                  && table.probe(12345, first, entry) && entry.g == TranspositionTable::unknown_g) << '\n';
+
+    // One table shared by every solve still gives optimal solutions: each
+    // length matches the exact distance from the full state space
+    Random::Generator gen{ Random::getStream(6, 0) };
+    std::cout << sharedTableIsOptimal<2, 4>(gen) << ' ' << sharedTableIsOptimal<4, 2>(gen) << ' '
+              << sharedTableIsOptimal<3, 3>(gen) << '\n';
+
+    // And with several threads solving through it at the same time
+    std::cout << threadsShareTable() << '\n';
+
+    return 0;
+}
@@ -0,0 +1,581 @@
+#include "BigInt.h"
+#include "Fraction.h"
+#include <cassert>
+#include <charconv>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using Limb = BigInt::Limb;
+    __extension__ typedef unsigned __int128 DoubleLimb;
+    __extension__ typedef __int128 Int128;
+
+    constexpr Limb decimal_chunk{ 10000000000000000000ULL };     // 10^19, the most that fits a limb
+    constexpr int decimal_chunk_digits{ 19 };
+
+    Limb subtractWithBorrow(Limb a, Limb b, Limb& borrow)
+    {
+        Limb difference{ a - b };
+        Limb nextBorrow{ static_cast<Limb>((a < b) | (difference < borrow)) };
+        difference -= borrow;
+        borrow = nextBorrow;
+        return difference;
+    }
+
+    // out[0..size) += x[0..count); returns the carry out of the top
+    Limb addInto(Limb* out, std::size_t size, const Limb* x, std::size_t count)
+    {
+        Limb carry{ 0 };
+        std::size_t i{ 0 };
+        for (; i < count; ++i)
+        {
+            DoubleLimb sum{ static_cast<DoubleLimb>(out[i]) + x[i] + carry };
+            out[i] = static_cast<Limb>(sum);
+            carry = static_cast<Limb>(sum >> 64);
+        }
+        for (; carry != 0 && i < size; ++i)
+            carry = (++out[i] == 0);
+        return carry;
+    }
+
+    // out[0..size) -= x[0..count); returns the borrow out of the top
+    Limb subtractInto(Limb* out, std::size_t size, const Limb* x, std::size_t count)
+    {
+        Limb borrow{ 0 };
+        std::size_t i{ 0 };
+        for (; i < count; ++i)
+            out[i] = subtractWithBorrow(out[i], x[i], borrow);
+        for (; borrow != 0 && i < size; ++i)
+            borrow = (out[i]-- == 0);
+        return borrow;
+    }
+
+    // out[0..countA + countB) = a * b, out zeroed beforehand
+    void multiplySchoolbook(const Limb* a, std::size_t countA, const Limb* b, std::size_t countB, Limb* out)
+    {
+        for (std::size_t i{ 0 }; i < countA; ++i)
+        {
+            Limb carry{ 0 };
+            for (std::size_t j{ 0 }; j < countB; ++j)
+            {
+                DoubleLimb product{ static_cast<DoubleLimb>(a[i]) * b[j] + out[i + j] + carry };
+                out[i + j] = static_cast<Limb>(product);
+                carry = static_cast<Limb>(product >> 64);
+            }
+            out[i + countB] = carry;
+        }
+    }
+
+    // out[0..countA + countB) = a * b. Karatsuba splits each number in two
+    // halves, a = a1 * B + a0, and makes the middle term out of one product
+    // of sums, (a0 + a1)(b0 + b1) - a0 b0 - a1 b1: three half-size products
+    // instead of four.
+    void multiplyInto(const Limb* a, std::size_t countA, const Limb* b, std::size_t countB, Limb* out,
+                      std::size_t threshold)
+    {
+        std::fill(out, out + countA + countB, Limb{ 0 });
+
+        // Sums of halves can carry into a limb that is then 0; left in, the
+        // recursion would not get any smaller
+        while (countA > 0 && a[countA - 1] == 0)
+            --countA;
+        while (countB > 0 && b[countB - 1] == 0)
+            --countB;
+        if (countA < countB)
+        {
+            std::swap(a, b);
+            std::swap(countA, countB);
+        }
+        if (countB == 0)
+            return;
+        if (countB < threshold)
+        {
+            multiplySchoolbook(a, countA, b, countB, out);
+            return;
+        }
+
+        // Very different lengths: the long one in pieces the size of the short one
+        if (2 * countB <= countA)
+        {
+            std::vector<Limb> piece(2 * countB);
+            for (std::size_t i{ 0 }; i < countA; i += countB)
+            {
+                std::size_t length{ std::min(countB, countA - i) };
+                multiplyInto(a + i, length, b, countB, piece.data(), threshold);
+                addInto(out + i, countA + countB - i, piece.data(), length + countB);
+            }
+            return;
+        }
+
+        // a0 b0 and a1 b1 go straight into their places in out
+        std::size_t half{ countA / 2 };
+        multiplyInto(a, half, b, half, out, threshold);
+        multiplyInto(a + half, countA - half, b + half, countB - half, out + 2 * half, threshold);
+
+        std::vector<Limb> sumA(countA - half + 1);
+        std::copy(a + half, a + countA, sumA.begin());
+        addInto(sumA.data(), sumA.size(), a, half);
+        std::vector<Limb> sumB(std::max(half, countB - half) + 1);
+        std::copy(b + half, b + countB, sumB.begin());
+        addInto(sumB.data(), sumB.size(), b, half);
+
+        std::vector<Limb> middle(sumA.size() + sumB.size());
+        multiplyInto(sumA.data(), sumA.size(), sumB.data(), sumB.size(), middle.data(), threshold);
+        subtractInto(middle.data(), middle.size(), out, 2 * half);
+        subtractInto(middle.data(), middle.size(), out + 2 * half, countA + countB - 2 * half);
+
+        std::size_t used{ middle.size() };
+        while (used > 0 && middle[used - 1] == 0)
+            --used;
+        addInto(out + half, countA + countB - half, middle.data(), used);
+    }
+
+    // Bits shift..shift + 64 of the magnitude
+    Limb getBits(const BigInt::LimbVector& limbs, std::size_t shift)
+    {
+        std::size_t index{ shift / 64 };
+        std::size_t bit{ shift % 64 };
+        if (index >= limbs.size())
+            return 0;
+        Limb bits{ limbs[index] >> bit };
+        if (bit != 0 && index + 1 < limbs.size())
+            bits |= limbs[index + 1] << (64 - bit);
+        return bits;
+    }
+
+    Limb magnitude(Int128 value)
+    {
+        Int128 absolute{ value < 0 ? -value : value };
+        assert(absolute <= static_cast<Int128>(UINT64_MAX) && "Lehmer cofactor out of range.");
+        return static_cast<Limb>(absolute);
+    }
+}
+
+BigInt::BigInt(long long value)
+    : m_negative{ value < 0 }
+{
+    if (value != 0)
+        m_limbs.push_back(value < 0 ? Limb{ 0 } - static_cast<Limb>(value) : static_cast<Limb>(value));
+}
+
+BigInt::BigInt(std::string_view decimal)
+{
+    bool negative{ false };
+    if (!decimal.empty() && (decimal[0] == '-' || decimal[0] == '+'))
+    {
+        negative = (decimal[0] == '-');
+        decimal.remove_prefix(1);
+    }
+    assert(!decimal.empty() && "Invalid BigInt.");
+
+    // 19 digits at a time, the first chunk taking what is left over
+    std::size_t length{ decimal.size() % decimal_chunk_digits };
+    if (length == 0)
+        length = decimal_chunk_digits;
+    for (std::size_t start{ 0 }; start < decimal.size(); start += length, length = decimal_chunk_digits)
+    {
+        Limb chunk{ 0 };
+        Limb scale{ 1 };
+        for (std::size_t i{ start }; i < start + length; ++i)
+        {
+            assert(decimal[i] >= '0' && decimal[i] <= '9' && "Invalid BigInt.");
+            chunk = chunk * 10 + static_cast<Limb>(decimal[i] - '0');
+            scale *= 10;
+        }
+        *this = addMagnitudes(multiplySmall(*this, scale), fromLimb(chunk));
+    }
+
+    m_negative = negative;
+    normalise();
+}
+
+BigInt BigInt::fromLimb(Limb limb)
+{
+    BigInt result{};
+    if (limb != 0)
+        result.m_limbs.push_back(limb);
+    return result;
+}
+
+void BigInt::normalise()
+{
+    m_limbs.trim();
+    if (m_limbs.empty())
+        m_negative = false;
+}
+
+std::size_t BigInt::getBitLength() const
+{
+    if (isZero())
+        return 0;
+    return 64 * m_limbs.size() - static_cast<std::size_t>(__builtin_clzll(m_limbs.back()));
+}
+
+bool BigInt::fitsInt64() const
+{
+    if (m_limbs.size() > 1)
+        return false;
+    Limb limit{ static_cast<Limb>(INT64_MAX) + (m_negative ? 1 : 0) };
+    return isZero() || m_limbs[0] <= limit;
+}
+
+long long BigInt::toInt64() const
+{
+    assert(fitsInt64() && "BigInt does not fit 64 bits.");
+    if (isZero())
+        return 0;
+    // Negated in the unsigned limb, so INT64_MIN works
+    return static_cast<long long>(m_negative ? Limb{ 0 } - m_limbs[0] : m_limbs[0]);
+}
+
+std::string BigInt::toString() const
+{
+    if (isZero())
+        return "0";
+
+    // Chunks of 19 digits from the right, by short division
+    std::vector<Limb> chunks{};
+    BigInt rest{ abs() };
+    while (!rest.isZero())
+        chunks.push_back(divideSmall(rest, decimal_chunk));
+
+    std::string text{ m_negative ? "-" : "" };
+    char buffer[decimal_chunk_digits]{};
+    for (std::size_t i{ chunks.size() }; i-- > 0;)
+    {
+        char* end{ std::to_chars(buffer, buffer + sizeof(buffer), chunks[i]).ptr };
+        if (i + 1 != chunks.size())
+            text.append(static_cast<std::size_t>(decimal_chunk_digits - (end - buffer)), '0');
+        text.append(buffer, end);
+    }
+    return text;
+}
+
+BigInt::operator double() const
+{
+    // The top 64 bits, scaled back up
+    std::size_t shift{ getBitLength() > 64 ? getBitLength() - 64 : 0 };
+    double value{ std::ldexp(static_cast<double>(getBits(m_limbs, shift)), static_cast<int>(shift)) };
+    return m_negative ? -value : value;
+}
+
+BigInt BigInt::abs() const
+{
+    BigInt result{ *this };
+    result.m_negative = false;
+    return result;
+}
+
+BigInt BigInt::operator-() const
+{
+    BigInt result{ *this };
+    result.m_negative = !m_negative && !isZero();
+    return result;
+}
+
+int BigInt::compareMagnitudes(const BigInt& a, const BigInt& b)
+{
+    if (a.m_limbs.size() != b.m_limbs.size())
+        return a.m_limbs.size() < b.m_limbs.size() ? -1 : 1;
+    for (std::size_t i{ a.m_limbs.size() }; i-- > 0;)
+    {
+        if (a.m_limbs[i] != b.m_limbs[i])
+            return a.m_limbs[i] < b.m_limbs[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+int BigInt::compare(const BigInt& a, const BigInt& b)
+{
+    if (a.m_negative != b.m_negative)
+        return a.m_negative ? -1 : 1;
+    int magnitudes{ compareMagnitudes(a, b) };
+    return a.m_negative ? -magnitudes : magnitudes;
+}
+
+BigInt BigInt::addMagnitudes(const BigInt& a, const BigInt& b)
+{
+    const BigInt& longer{ a.m_limbs.size() >= b.m_limbs.size() ? a : b };
+    const BigInt& shorter{ a.m_limbs.size() >= b.m_limbs.size() ? b : a };
+
+    BigInt result{};
+    result.m_limbs.resize(longer.m_limbs.size() + 1);
+    std::copy(longer.m_limbs.data(), longer.m_limbs.data() + longer.m_limbs.size(), result.m_limbs.data());
+    addInto(result.m_limbs.data(), result.m_limbs.size(), shorter.m_limbs.data(), shorter.m_limbs.size());
+    result.normalise();
+    return result;
+}
+
+BigInt BigInt::subtractMagnitudes(const BigInt& a, const BigInt& b)
+{
+    BigInt result{};
+    result.m_limbs = a.m_limbs;
+    Limb borrow{ subtractInto(result.m_limbs.data(), result.m_limbs.size(), b.m_limbs.data(), b.m_limbs.size()) };
+    assert(borrow == 0 && "Subtracting a larger magnitude.");
+    (void)borrow;
+    result.normalise();
+    return result;
+}
+
+BigInt::Limb BigInt::divideSmall(BigInt& a, Limb divisor)
+{
+    Limb remainder{ 0 };
+    for (std::size_t i{ a.m_limbs.size() }; i-- > 0;)
+    {
+        DoubleLimb current{ (static_cast<DoubleLimb>(remainder) << 64) | a.m_limbs[i] };
+        a.m_limbs[i] = static_cast<Limb>(current / divisor);
+        remainder = static_cast<Limb>(current % divisor);
+    }
+    a.normalise();
+    return remainder;
+}
+
+BigInt BigInt::multiplySmall(const BigInt& a, Limb factor)
+{
+    BigInt result{};
+    result.m_limbs.resize(a.m_limbs.size() + 1);
+    Limb carry{ 0 };
+    for (std::size_t i{ 0 }; i < a.m_limbs.size(); ++i)
+    {
+        DoubleLimb product{ static_cast<DoubleLimb>(a.m_limbs[i]) * factor + carry };
+        result.m_limbs[i] = static_cast<Limb>(product);
+        carry = static_cast<Limb>(product >> 64);
+    }
+    result.m_limbs[a.m_limbs.size()] = carry;
+    result.m_negative = a.m_negative;
+    result.normalise();
+    return result;
+}
+
+BigInt BigInt::multiply(const BigInt& a, const BigInt& b, std::size_t threshold)
+{
+    BigInt result{};
+    if (a.isZero() || b.isZero())
+        return result;
+
+    result.m_limbs.resize(a.m_limbs.size() + b.m_limbs.size());
+    multiplyInto(a.m_limbs.data(), a.m_limbs.size(), b.m_limbs.data(), b.m_limbs.size(), result.m_limbs.data(),
+                 std::max<std::size_t>(threshold, 2));
+    result.m_negative = a.m_negative != b.m_negative;
+    result.normalise();
+    return result;
+}
+
+// Knuth's algorithm D: long division one limb of quotient at a time, each
+// guessed from the top two limbs of what is left and the top limb of the
+// divisor. Shifting both so the divisor's top bit is set makes the guess at
+// most two too big.
+void BigInt::divideMagnitudes(const BigInt& a, const BigInt& b, BigInt& quotient, BigInt& remainder)
+{
+    if (compareMagnitudes(a, b) < 0)
+    {
+        remainder = a.abs();
+        quotient = BigInt{};
+        return;
+    }
+    if (b.m_limbs.size() == 1)
+    {
+        quotient = a.abs();
+        remainder = fromLimb(divideSmall(quotient, b.m_limbs[0]));
+        return;
+    }
+
+    std::size_t shift{ static_cast<std::size_t>(__builtin_clzll(b.m_limbs.back())) };
+    BigInt divisor{ b.abs() << shift };
+    BigInt rest{ a.abs() << shift };
+    std::size_t n{ divisor.m_limbs.size() };
+    std::size_t m{ a.m_limbs.size() - n };
+    rest.m_limbs.resize(a.m_limbs.size() + 1);
+    const Limb* v{ divisor.m_limbs.data() };
+    Limb* u{ rest.m_limbs.data() };
+
+    quotient = BigInt{};
+    quotient.m_limbs.resize(m + 1);
+    for (std::size_t j{ m + 1 }; j-- > 0;)
+    {
+        DoubleLimb top{ (static_cast<DoubleLimb>(u[j + n]) << 64) | u[j + n - 1] };
+        DoubleLimb guess{ top / v[n - 1] };
+        DoubleLimb guessRemainder{ top % v[n - 1] };
+        while ((guess >> 64) != 0
+               || guess * v[n - 2] > ((guessRemainder << 64) | u[j + n - 2]))
+        {
+            --guess;
+            guessRemainder += v[n - 1];
+            if ((guessRemainder >> 64) != 0)
+                break;
+        }
+
+        // Subtract guess * divisor; still one too big if that goes negative
+        Limb carry{ 0 };
+        Limb borrow{ 0 };
+        for (std::size_t i{ 0 }; i < n; ++i)
+        {
+            DoubleLimb product{ guess * v[i] + carry };
+            carry = static_cast<Limb>(product >> 64);
+            u[i + j] = subtractWithBorrow(u[i + j], static_cast<Limb>(product), borrow);
+        }
+        u[j + n] = subtractWithBorrow(u[j + n], carry, borrow);
+        if (borrow != 0)
+        {
+            --guess;
+            u[j + n] += addInto(u + j, n, v, n);
+        }
+        quotient.m_limbs[j] = static_cast<Limb>(guess);
+    }
+    quotient.normalise();
+
+    rest.m_limbs.resize(n);
+    rest.normalise();
+    remainder = rest >> shift;
+}
+
+void BigInt::divide(const BigInt& a, const BigInt& b, BigInt& quotient, BigInt& remainder)
+{
+    assert(!b.isZero() && "Divide by zero");
+    bool negativeQuotient{ a.m_negative != b.m_negative };
+    bool negativeRemainder{ a.m_negative };
+    divideMagnitudes(a, b, quotient, remainder);
+    quotient.m_negative = negativeQuotient;
+    quotient.normalise();
+    remainder.m_negative = negativeRemainder;
+    remainder.normalise();
+}
+
+BigInt BigInt::combine(const BigInt& a, Limb factorA, const BigInt& b, Limb factorB, bool positiveB)
+{
+    BigInt productA{ multiplySmall(a, factorA) };
+    BigInt productB{ multiplySmall(b, factorB) };
+    return positiveB ? subtractMagnitudes(productB, productA) : subtractMagnitudes(productA, productB);
+}
+
+// Lehmer's algorithm: the Euclidean steps for the leading 64 bits of a and
+// b are the same as for a and b themselves for as long as the quotients
+// agree at both ends of the range the leading bits allow. Those steps are
+// run in single words, collecting a matrix [A B; C D], which is then applied
+// to a and b in one pass: one multi-limb update for many quotients.
+BigInt BigInt::gcd(BigInt a, BigInt b)
+{
+    a.m_negative = false;
+    b.m_negative = false;
+    if (compareMagnitudes(a, b) < 0)
+        std::swap(a, b);
+
+    while (b.m_limbs.size() > 1)
+    {
+        std::size_t shift{ a.getBitLength() - 64 };
+        Int128 x{ getBits(a.m_limbs, shift) };
+        Int128 y{ getBits(b.m_limbs, shift) };
+        Int128 A{ 1 };
+        Int128 B{ 0 };
+        Int128 C{ 0 };
+        Int128 D{ 1 };
+        while (y + C > 0 && y + D > 0)
+        {
+            Int128 q{ (x + A) / (y + C) };
+            if (q != (x + B) / (y + D))
+                break;
+            Int128 next{ A - q * C };
+            A = C;
+            C = next;
+            next = B - q * D;
+            B = D;
+            D = next;
+            next = x - q * y;
+            x = y;
+            y = next;
+        }
+
+        if (B == 0)
+        {
+            // No step could be taken on the leading bits: one full division
+            BigInt remainder{ a % b };
+            a = std::move(b);
+            b = std::move(remainder);
+        }
+        else
+        {
+            BigInt nextA{ combine(a, magnitude(A), b, magnitude(B), B > 0) };
+            b = combine(a, magnitude(C), b, magnitude(D), D > 0);
+            a = std::move(nextA);
+        }
+    }
+
+    if (b.isZero())
+        return a;
+    Limb last{ b.m_limbs[0] };
+    return fromLimb(BasicFraction<std::int64_t>::gcd(last, divideSmall(a, last)));
+}
+
+BigInt& BigInt::operator+=(const BigInt& b)
+{
+    bool negative{ m_negative };
+    if (m_negative == b.m_negative)
+        *this = addMagnitudes(*this, b);
+    else if (compareMagnitudes(*this, b) >= 0)
+        *this = subtractMagnitudes(*this, b);
+    else
+    {
+        *this = subtractMagnitudes(b, *this);
+        negative = !negative;
+    }
+    m_negative = negative;
+    normalise();
+    return *this;
+}
+
+BigInt& BigInt::operator-=(const BigInt& b)
+{
+    return *this += -b;
+}
+
+BigInt& BigInt::operator/=(const BigInt& b)
+{
+    BigInt remainder{};
+    divide(*this, b, *this, remainder);
+    return *this;
+}
+
+BigInt& BigInt::operator%=(const BigInt& b)
+{
+    BigInt quotient{};
+    divide(*this, b, quotient, *this);
+    return *this;
+}
+
+BigInt& BigInt::operator<<=(std::size_t bits)
+{
+    if (isZero())
+        return *this;
+    std::size_t limbs{ bits / 64 };
+    std::size_t bit{ bits % 64 };
+    std::size_t size{ m_limbs.size() };
+    m_limbs.resize(size + limbs + 1);
+    for (std::size_t i{ size + limbs + 1 }; i-- > limbs;)
+    {
+        std::size_t from{ i - limbs };
+        Limb high{ from < size ? m_limbs[from] << bit : 0 };
+        Limb low{ (bit != 0 && from > 0 && from - 1 < size) ? m_limbs[from - 1] >> (64 - bit) : 0 };
+        m_limbs[i] = high | low;
+    }
+    std::fill(m_limbs.data(), m_limbs.data() + limbs, Limb{ 0 });
+    normalise();
+    return *this;
+}
+
+BigInt& BigInt::operator>>=(std::size_t bits)
+{
+    std::size_t limbs{ bits / 64 };
+    if (limbs >= m_limbs.size())
+    {
+        *this = BigInt{};
+        return *this;
+    }
+    std::size_t size{ m_limbs.size() - limbs };
+    for (std::size_t i{ 0 }; i < size; ++i)
+        m_limbs[i] = getBits(m_limbs, bits + 64 * i);
+    m_limbs.resize(size);
+    normalise();
+    return *this;
+}
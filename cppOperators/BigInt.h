@@ -0,0 +1,215 @@
+#ifndef BIG_INT_H
+#define BIG_INT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+// Integer of any size: a sign and a magnitude in 64-bit limbs, lowest limb
+// first. Values up to 128 bits keep their limbs inside the object; larger
+// ones move them to the heap.
+//
+// Multiplication switches from schoolbook to Karatsuba once both numbers
+// have karatsuba_threshold limbs; gcd() is Lehmer's, which replaces most
+// long divisions with arithmetic on the leading 64 bits. / and % truncate
+// toward zero like int.
+class BigInt
+{
+public:
+    using Limb = std::uint64_t;
+
+    static constexpr std::size_t karatsuba_threshold{ 32 };
+
+    // Limbs with room for inline_limbs before allocating
+    class LimbVector
+    {
+    public:
+        static constexpr std::size_t inline_limbs{ 2 };
+
+    private:
+        Limb* m_heap{ nullptr };
+        std::size_t m_size{ 0 };
+        std::size_t m_capacity{ inline_limbs };
+        Limb m_inline[inline_limbs]{};
+
+        void release()
+        {
+            delete[] m_heap;
+            m_heap = nullptr;
+            m_capacity = inline_limbs;
+        }
+
+        void moveFrom(LimbVector& other)
+        {
+            if (other.m_heap)
+            {
+                m_heap = other.m_heap;
+                m_capacity = other.m_capacity;
+                other.m_heap = nullptr;
+                other.m_capacity = inline_limbs;
+            }
+            else
+                std::copy(other.m_inline, other.m_inline + other.m_size, m_inline);
+            m_size = other.m_size;
+            other.m_size = 0;
+        }
+
+    public:
+        LimbVector() = default;
+
+        LimbVector(const LimbVector& other)
+        {
+            resize(other.m_size);
+            std::copy(other.data(), other.data() + other.m_size, data());
+        }
+
+        LimbVector(LimbVector&& other) noexcept { moveFrom(other); }
+
+        LimbVector& operator=(const LimbVector& other)
+        {
+            if (this != &other)
+            {
+                m_size = 0;
+                resize(other.m_size);
+                std::copy(other.data(), other.data() + other.m_size, data());
+            }
+            return *this;
+        }
+
+        LimbVector& operator=(LimbVector&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        ~LimbVector() { release(); }
+
+        std::size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        bool isInline() const { return m_heap == nullptr; }
+
+        Limb* data() { return m_heap ? m_heap : m_inline; }
+        const Limb* data() const { return m_heap ? m_heap : m_inline; }
+        Limb& operator[](std::size_t index) { return data()[index]; }
+        Limb operator[](std::size_t index) const { return data()[index]; }
+        Limb back() const { return data()[m_size - 1]; }
+
+        // New limbs are 0
+        void resize(std::size_t size)
+        {
+            if (size > m_capacity)
+            {
+                std::size_t capacity{ std::max(size, 2 * m_capacity) };
+                Limb* heap{ new Limb[capacity] };
+                std::copy(data(), data() + m_size, heap);
+                delete[] m_heap;
+                m_heap = heap;
+                m_capacity = capacity;
+            }
+            if (size > m_size)
+                std::fill(data() + m_size, data() + size, Limb{ 0 });
+            m_size = size;
+        }
+
+        void push_back(Limb limb)
+        {
+            resize(m_size + 1);
+            data()[m_size - 1] = limb;
+        }
+
+        // Drops leading zero limbs
+        void trim()
+        {
+            while (m_size > 0 && data()[m_size - 1] == 0)
+                --m_size;
+        }
+    };
+
+private:
+    LimbVector m_limbs{};       // magnitude, no leading zero limbs (empty for 0)
+    bool m_negative{ false };   // never true for 0
+
+    static BigInt fromLimb(Limb limb);
+    void normalise();   // trims the limbs, and 0 is never negative
+
+    static int compareMagnitudes(const BigInt& a, const BigInt& b);
+    static BigInt addMagnitudes(const BigInt& a, const BigInt& b);
+    static BigInt subtractMagnitudes(const BigInt& a, const BigInt& b);     // |a| >= |b|
+    static Limb divideSmall(BigInt& a, Limb divisor);                      // magnitude in place, returns remainder
+    static BigInt multiplySmall(const BigInt& a, Limb factor);
+    static void divideMagnitudes(const BigInt& a, const BigInt& b, BigInt& quotient, BigInt& remainder);
+
+    // A * a + B * b for Lehmer cofactors, which have opposite signs (or A is
+    // 0), given as magnitudes and the sign of B
+    static BigInt combine(const BigInt& a, Limb factorA, const BigInt& b, Limb factorB, bool positiveB);
+
+public:
+    BigInt() = default;
+    BigInt(long long value);
+
+    // Optional sign then decimal digits
+    explicit BigInt(std::string_view decimal);
+
+    bool isZero() const { return m_limbs.empty(); }
+    bool isNegative() const { return m_negative; }
+    int getSign() const { return m_negative ? -1 : (isZero() ? 0 : 1); }
+    std::size_t getLimbCount() const { return m_limbs.size(); }
+    const LimbVector& getLimbs() const { return m_limbs; }
+    std::size_t getBitLength() const;
+
+    bool fitsInt64() const;
+    long long toInt64() const;  // only if fitsInt64()
+    std::string toString() const;
+    explicit operator double() const;
+
+    BigInt abs() const;
+    BigInt operator-() const;
+    BigInt operator+() const { return *this; }
+
+    // Products with Karatsuba used from 'threshold' limbs (a huge threshold
+    // gives schoolbook multiplication throughout)
+    static BigInt multiply(const BigInt& a, const BigInt& b, std::size_t threshold = karatsuba_threshold);
+
+    // Truncating division: quotient toward zero, remainder with a's sign
+    static void divide(const BigInt& a, const BigInt& b, BigInt& quotient, BigInt& remainder);
+
+    // Greatest common divisor (never negative) by Lehmer's algorithm
+    static BigInt gcd(BigInt a, BigInt b);
+
+    BigInt& operator+=(const BigInt& b);
+    BigInt& operator-=(const BigInt& b);
+    BigInt& operator*=(const BigInt& b) { return *this = multiply(*this, b); }
+    BigInt& operator/=(const BigInt& b);
+    BigInt& operator%=(const BigInt& b);
+    BigInt& operator<<=(std::size_t bits);
+    BigInt& operator>>=(std::size_t bits);     // of the magnitude
+
+    friend BigInt operator+(BigInt a, const BigInt& b) { return a += b; }
+    friend BigInt operator-(BigInt a, const BigInt& b) { return a -= b; }
+    friend BigInt operator*(const BigInt& a, const BigInt& b) { return multiply(a, b); }
+    friend BigInt operator/(BigInt a, const BigInt& b) { return a /= b; }
+    friend BigInt operator%(BigInt a, const BigInt& b) { return a %= b; }
+    friend BigInt operator<<(BigInt a, std::size_t bits) { return a <<= bits; }
+    friend BigInt operator>>(BigInt a, std::size_t bits) { return a >>= bits; }
+
+    // Sign of a - b
+    static int compare(const BigInt& a, const BigInt& b);
+
+    friend bool operator==(const BigInt& a, const BigInt& b) { return compare(a, b) == 0; }
+    friend bool operator!=(const BigInt& a, const BigInt& b) { return compare(a, b) != 0; }
+    friend bool operator<(const BigInt& a, const BigInt& b) { return compare(a, b) < 0; }
+    friend bool operator>(const BigInt& a, const BigInt& b) { return compare(a, b) > 0; }
+    friend bool operator<=(const BigInt& a, const BigInt& b) { return compare(a, b) <= 0; }
+    friend bool operator>=(const BigInt& a, const BigInt& b) { return compare(a, b) >= 0; }
+
+    friend std::ostream& operator<<(std::ostream& out, const BigInt& value) { return out << value.toString(); }
+};
+
+#endif
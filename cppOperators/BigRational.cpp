@@ -0,0 +1,129 @@
+#include "BigRational.h"
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+BigRational::BigRational(long long numerator, long long denominator)
+{
+    assert(denominator != 0 && "Divide by zero");
+    // Only INT64_MIN over a negative denominator can fail to fit
+    if (!Small::tryDivide(Small{ numerator }, Small{ denominator }, m_small))
+        *this = make(BigInt{ numerator }, BigInt{ denominator });
+}
+
+BigRational::BigRational(const BigInt& numerator, const BigInt& denominator)
+    : BigRational{ make(numerator, denominator) }
+{}
+
+BigRational BigRational::make(BigInt numerator, BigInt denominator)
+{
+    assert(!denominator.isZero() && "Divide by zero");
+    if (denominator.isNegative())
+    {
+        numerator = -numerator;
+        denominator = -denominator;
+    }
+
+    BigInt divisor{ BigInt::gcd(numerator, denominator) };
+    if (divisor != 1)
+    {
+        numerator /= divisor;
+        denominator /= divisor;
+    }
+
+    BigRational result{};
+    if (numerator.fitsInt64() && denominator.fitsInt64())
+        result.m_small = Small{ numerator.toInt64(), denominator.toInt64() };
+    else
+    {
+        result.m_numerator = std::move(numerator);
+        result.m_denominator = std::move(denominator);
+        result.m_isBig = true;
+    }
+    return result;
+}
+
+void BigRational::reduce()
+{
+    if (!m_isBig)
+        m_small.reduce();
+}
+
+BigInt BigRational::getNumerator() const
+{
+    return m_isBig ? m_numerator : BigInt{ m_small.getNumerator() };
+}
+
+BigInt BigRational::getDenominator() const
+{
+    return m_isBig ? m_denominator : BigInt{ m_small.getDenominator() };
+}
+
+BigRational::operator double() const
+{
+    if (!m_isBig)
+        return static_cast<double>(m_small);
+
+    // Both cut to their top 64 bits, so neither overflows a double on its own
+    std::size_t shiftNumerator{ m_numerator.getBitLength() > 64 ? m_numerator.getBitLength() - 64 : 0 };
+    std::size_t shiftDenominator{ m_denominator.getBitLength() > 64 ? m_denominator.getBitLength() - 64 : 0 };
+    double ratio{ static_cast<double>(m_numerator >> shiftNumerator) / static_cast<double>(m_denominator >> shiftDenominator) };
+    return std::ldexp(ratio, static_cast<int>(shiftNumerator) - static_cast<int>(shiftDenominator));
+}
+
+BigRational BigRational::operator-() const
+{
+    BigRational result{ *this };
+    if (m_isBig)
+        result.m_numerator = -m_numerator;
+    else if (!Small::trySubtract(Small{}, m_small, result.m_small))
+        result = make(-getNumerator(), getDenominator());
+    return result;
+}
+
+BigRational& BigRational::operator+=(const BigRational& r2)
+{
+    if (!m_isBig && !r2.m_isBig && Small::tryAdd(m_small, r2.m_small, m_small))
+        return *this;
+    BigInt denominator2{ r2.getDenominator() };
+    BigInt denominator1{ getDenominator() };
+    return *this = make(getNumerator() * denominator2 + r2.getNumerator() * denominator1, denominator1 * denominator2);
+}
+
+BigRational& BigRational::operator-=(const BigRational& r2)
+{
+    if (!m_isBig && !r2.m_isBig && Small::trySubtract(m_small, r2.m_small, m_small))
+        return *this;
+    BigInt denominator2{ r2.getDenominator() };
+    BigInt denominator1{ getDenominator() };
+    return *this = make(getNumerator() * denominator2 - r2.getNumerator() * denominator1, denominator1 * denominator2);
+}
+
+BigRational& BigRational::operator*=(const BigRational& r2)
+{
+    if (!m_isBig && !r2.m_isBig && Small::tryMultiply(m_small, r2.m_small, m_small))
+        return *this;
+    return *this = make(getNumerator() * r2.getNumerator(), getDenominator() * r2.getDenominator());
+}
+
+BigRational& BigRational::operator/=(const BigRational& r2)
+{
+    assert(r2 != 0 && "Divide by zero");
+    if (!m_isBig && !r2.m_isBig && Small::tryDivide(m_small, r2.m_small, m_small))
+        return *this;
+    return *this = make(getNumerator() * r2.getDenominator(), getDenominator() * r2.getNumerator());
+}
+
+int BigRational::compare(const BigRational& r1, const BigRational& r2)
+{
+    if (!r1.m_isBig && !r2.m_isBig)
+        return (r1.m_small > r2.m_small) - (r1.m_small < r2.m_small);
+    return BigInt::compare(r1.getNumerator() * r2.getDenominator(), r2.getNumerator() * r1.getDenominator());
+}
+
+std::ostream& operator<<(std::ostream& out, const BigRational& r1)
+{
+    if (!r1.m_isBig)
+        return out << r1.m_small;
+    return out << r1.m_numerator << '/' << r1.m_denominator;
+}
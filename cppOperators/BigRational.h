@@ -0,0 +1,78 @@
+#ifndef BIG_RATIONAL_H
+#define BIG_RATIONAL_H
+
+#include "BigInt.h"
+#include "Fraction.h"
+#include <cstdint>
+#include <iostream>
+
+// Exact rational number of any size.
+//
+// While the numerator and denominator fit 64 bits the value is a 64-bit
+// Fraction kept inside the object, and arithmetic takes Fraction's 128-bit
+// path. Only a result that does not fit even in lowest terms moves to a
+// BigInt numerator and denominator, and a big result that reduces back into
+// 64 bits moves back. Big values are always in lowest terms.
+class BigRational
+{
+public:
+    using Small = BasicFraction<std::int64_t>;
+
+private:
+    Small m_small{};
+    BigInt m_numerator{};       // only while m_isBig
+    BigInt m_denominator{ 1 };  // only while m_isBig, always positive
+    bool m_isBig{ false };
+
+    // numerator/denominator in lowest terms, small if it fits
+    static BigRational make(BigInt numerator, BigInt denominator);
+
+    // Sign of r1 - r2
+    static int compare(const BigRational& r1, const BigRational& r2);
+
+public:
+    BigRational(long long numerator = 0, long long denominator = 1);
+    BigRational(const Small& value) : m_small{ value } {}
+    explicit BigRational(const Fraction& value) : m_small{ value.getNumerator(), value.getDenominator() } {}
+    BigRational(const BigInt& numerator, const BigInt& denominator = BigInt{ 1 });
+
+    bool isSmall() const { return !m_isBig; }
+
+    // Lowest terms (big values already are)
+    void reduce();
+
+    BigInt getNumerator() const;
+    BigInt getDenominator() const;
+
+    explicit operator double() const;
+
+    void print() const
+    {
+        std::cout << *this << '\n';
+    }
+
+    BigRational operator-() const;
+    BigRational operator+() const { return *this; }
+
+    BigRational& operator+=(const BigRational& r2);
+    BigRational& operator-=(const BigRational& r2);
+    BigRational& operator*=(const BigRational& r2);
+    BigRational& operator/=(const BigRational& r2);
+
+    friend BigRational operator+(BigRational r1, const BigRational& r2) { return r1 += r2; }
+    friend BigRational operator-(BigRational r1, const BigRational& r2) { return r1 -= r2; }
+    friend BigRational operator*(BigRational r1, const BigRational& r2) { return r1 *= r2; }
+    friend BigRational operator/(BigRational r1, const BigRational& r2) { return r1 /= r2; }
+
+    friend bool operator==(const BigRational& r1, const BigRational& r2) { return compare(r1, r2) == 0; }
+    friend bool operator!=(const BigRational& r1, const BigRational& r2) { return compare(r1, r2) != 0; }
+    friend bool operator<(const BigRational& r1, const BigRational& r2) { return compare(r1, r2) < 0; }
+    friend bool operator>(const BigRational& r1, const BigRational& r2) { return compare(r1, r2) > 0; }
+    friend bool operator<=(const BigRational& r1, const BigRational& r2) { return compare(r1, r2) <= 0; }
+    friend bool operator>=(const BigRational& r1, const BigRational& r2) { return compare(r1, r2) >= 0; }
+
+    // In lowest terms
+    friend std::ostream& operator<<(std::ostream& out, const BigRational& r1);
+};
+
+#endif
@@ -0,0 +1,260 @@
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+// How multiply() and divide() round a result to the last decimal place
+enum class FixedPointRounding
+{
+    towardZero,
+    down,               // toward -infinity
+    up,                 // toward +infinity
+    halfAwayFromZero,   // 0.005 -> 0.01, -0.005 -> -0.01
+    halfEven,           // 0.005 -> 0.00, 0.015 -> 0.02 (banker's rounding)
+};
+
+// Value to DecimalDigits decimal places held as a whole number of
+// 10^-DecimalDigits units in an IntType, so that +, -, * and / are exact
+// integer arithmetic (no double round trip). FixedPoint<std::int64_t, 2>
+// (FixedPoint2) has a range of about +-92 million billion.
+//
+// * and / round their result to the last decimal place, halves away from
+// zero like std::round; multiply() and divide() take any Rounding. Results
+// that do not fit fail an assert; tryAdd() and friends report overflow
+// instead. Products and quotients go through an intermediate twice as wide
+// (128 bits for 64-bit values).
+template <typename IntType, int DecimalDigits>
+class FixedPoint
+{
+    static_assert(std::is_integral_v<IntType> && std::is_signed_v<IntType> && sizeof(IntType) <= 8,
+                  "FixedPoint needs a signed integer of up to 64 bits.");
+    static_assert(DecimalDigits >= 0 && DecimalDigits < std::numeric_limits<IntType>::digits10,
+                  "Too many decimal digits for the integer type.");
+
+public:
+    using Raw = IntType;
+    using Rounding = FixedPointRounding;
+
+    static constexpr int decimal_digits{ DecimalDigits };
+
+    static constexpr Raw makeScale()
+    {
+        Raw result{ 1 };
+        for (int digit{ 0 }; digit < DecimalDigits; ++digit)
+            result *= 10;
+        return result;
+    }
+
+    static constexpr Raw scale{ makeScale() };
+
+    __extension__ typedef __int128 Int128;
+    using Wide = std::conditional_t<(sizeof(IntType) <= 4), std::int64_t, Int128>;
+
+    // numerator / denominator rounded to a whole number
+    static constexpr Wide divideRounded(Wide numerator, Wide denominator, Rounding rounding)
+    {
+        assert(denominator != 0 && "FixedPoint division by zero.");
+
+        Wide quotient{ numerator / denominator };
+        Wide remainder{ numerator % denominator };
+        if (remainder == 0)
+            return quotient;
+
+        bool negative{ (numerator < 0) != (denominator < 0) };
+        Wide away{ negative ? quotient - 1 : quotient + 1 };
+
+        switch (rounding)
+        {
+        case Rounding::towardZero:
+            return quotient;
+        case Rounding::down:
+            return negative ? away : quotient;
+        case Rounding::up:
+            return negative ? quotient : away;
+        default:
+            break;
+        }
+
+        Wide twice{ 2 * (remainder < 0 ? -remainder : remainder) };
+        Wide half{ denominator < 0 ? -denominator : denominator };
+        if (twice > half)
+            return away;
+        if (twice < half)
+            return quotient;
+        if (rounding == Rounding::halfAwayFromZero || quotient % 2 != 0)
+            return away;
+        return quotient;
+    }
+
+private:
+    Raw m_value{ 0 };   // units of 1 / scale
+
+    static constexpr Raw min_raw{ std::numeric_limits<Raw>::min() };
+    static constexpr Raw max_raw{ std::numeric_limits<Raw>::max() };
+
+    static constexpr bool fits(Wide value)
+    {
+        return value >= min_raw && value <= max_raw;
+    }
+
+public:
+    constexpr FixedPoint() = default;
+
+    // Integer and decimal parts; the value is negative if either part is
+    // (FixedPoint2{ -2, 8 } and FixedPoint2{ 2, -8 } are both -2.08)
+    constexpr FixedPoint(Raw integer, int decimal)
+    {
+        assert(decimal > -scale && decimal < scale && "Decimal part must be under the scale.");
+        assert(integer > min_raw / scale + 1 && integer < max_raw / scale - 1 && "FixedPoint overflow.");
+
+        Raw magnitude{ static_cast<Raw>((integer < 0 ? -integer : integer) * scale + (decimal < 0 ? -decimal : decimal)) };
+        m_value = (integer < 0 || decimal < 0) ? static_cast<Raw>(-magnitude) : magnitude;
+    }
+
+    // Nearest unit, halves away from zero
+    constexpr explicit FixedPoint(double value)
+    {
+        double scaled{ value * scale };
+        assert(scaled > static_cast<double>(min_raw) && scaled < static_cast<double>(max_raw) && "FixedPoint overflow.");
+        m_value = static_cast<Raw>(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+    }
+
+    static constexpr FixedPoint fromRaw(Raw units)
+    {
+        FixedPoint result{};
+        result.m_value = units;
+        return result;
+    }
+
+    constexpr Raw getRaw() const { return m_value; }
+    constexpr Raw getInteger() const { return m_value / scale; }
+    constexpr int getDecimal() const { return static_cast<int>(m_value % scale); }
+
+    constexpr explicit operator double() const
+    {
+        return static_cast<double>(getInteger()) + static_cast<double>(getDecimal()) / scale;
+    }
+
+    // Checked arithmetic: false (and result untouched) on overflow
+    static constexpr bool tryAdd(FixedPoint x, FixedPoint y, FixedPoint& result)
+    {
+        Raw sum{ 0 };
+        if (__builtin_add_overflow(x.m_value, y.m_value, &sum))
+            return false;
+        result.m_value = sum;
+        return true;
+    }
+
+    static constexpr bool trySubtract(FixedPoint x, FixedPoint y, FixedPoint& result)
+    {
+        Raw difference{ 0 };
+        if (__builtin_sub_overflow(x.m_value, y.m_value, &difference))
+            return false;
+        result.m_value = difference;
+        return true;
+    }
+
+    static constexpr bool tryMultiply(FixedPoint x, FixedPoint y, FixedPoint& result,
+                                      Rounding rounding = Rounding::halfAwayFromZero)
+    {
+        Wide product{ divideRounded(static_cast<Wide>(x.m_value) * y.m_value, scale, rounding) };
+        if (!fits(product))
+            return false;
+        result.m_value = static_cast<Raw>(product);
+        return true;
+    }
+
+    static constexpr bool tryDivide(FixedPoint x, FixedPoint y, FixedPoint& result,
+                                    Rounding rounding = Rounding::halfAwayFromZero)
+    {
+        Wide quotient{ divideRounded(static_cast<Wide>(x.m_value) * scale, y.m_value, rounding) };
+        if (!fits(quotient))
+            return false;
+        result.m_value = static_cast<Raw>(quotient);
+        return true;
+    }
+
+    static constexpr FixedPoint multiply(FixedPoint x, FixedPoint y, Rounding rounding)
+    {
+        FixedPoint result{};
+        bool valid{ tryMultiply(x, y, result, rounding) };
+        assert(valid && "FixedPoint overflow.");
+        (void)valid;
+        return result;
+    }
+
+    static constexpr FixedPoint divide(FixedPoint x, FixedPoint y, Rounding rounding)
+    {
+        FixedPoint result{};
+        bool valid{ tryDivide(x, y, result, rounding) };
+        assert(valid && "FixedPoint overflow.");
+        (void)valid;
+        return result;
+    }
+
+    // Whole multiples are exact; sharing out rounds like divide()
+    static constexpr FixedPoint multiply(FixedPoint x, Raw factor)
+    {
+        FixedPoint result{};
+        bool overflow{ __builtin_mul_overflow(x.m_value, factor, &result.m_value) };
+        assert(!overflow && "FixedPoint overflow.");
+        (void)overflow;
+        return result;
+    }
+
+    static constexpr FixedPoint divide(FixedPoint x, Raw divisor, Rounding rounding)
+    {
+        Wide quotient{ divideRounded(x.m_value, divisor, rounding) };
+        assert(fits(quotient) && "FixedPoint overflow.");
+        return fromRaw(static_cast<Raw>(quotient));
+    }
+
+    constexpr FixedPoint operator-() const
+    {
+        assert(m_value != min_raw && "FixedPoint overflow.");
+        return fromRaw(static_cast<Raw>(-m_value));
+    }
+
+    constexpr FixedPoint operator+() const { return *this; }
+
+    constexpr FixedPoint& operator+=(FixedPoint y)
+    {
+        bool valid{ tryAdd(*this, y, *this) };
+        assert(valid && "FixedPoint overflow.");
+        (void)valid;
+        return *this;
+    }
+
+    constexpr FixedPoint& operator-=(FixedPoint y)
+    {
+        bool valid{ trySubtract(*this, y, *this) };
+        assert(valid && "FixedPoint overflow.");
+        (void)valid;
+        return *this;
+    }
+
+    constexpr FixedPoint& operator*=(FixedPoint y) { return *this = multiply(*this, y, Rounding::halfAwayFromZero); }
+    constexpr FixedPoint& operator/=(FixedPoint y) { return *this = divide(*this, y, Rounding::halfAwayFromZero); }
+    constexpr FixedPoint& operator*=(Raw factor) { return *this = multiply(*this, factor); }
+    constexpr FixedPoint& operator/=(Raw divisor) { return *this = divide(*this, divisor, Rounding::halfAwayFromZero); }
+
+    friend constexpr FixedPoint operator+(FixedPoint x, FixedPoint y) { return x += y; }
+    friend constexpr FixedPoint operator-(FixedPoint x, FixedPoint y) { return x -= y; }
+    friend constexpr FixedPoint operator*(FixedPoint x, FixedPoint y) { return x *= y; }
+    friend constexpr FixedPoint operator/(FixedPoint x, FixedPoint y) { return x /= y; }
+    friend constexpr FixedPoint operator*(FixedPoint x, Raw factor) { return x *= factor; }
+    friend constexpr FixedPoint operator*(Raw factor, FixedPoint x) { return x *= factor; }
+    friend constexpr FixedPoint operator/(FixedPoint x, Raw divisor) { return x /= divisor; }
+
+    friend constexpr bool operator==(FixedPoint x, FixedPoint y) { return x.m_value == y.m_value; }
+    friend constexpr bool operator!=(FixedPoint x, FixedPoint y) { return x.m_value != y.m_value; }
+    friend constexpr bool operator<(FixedPoint x, FixedPoint y) { return x.m_value < y.m_value; }
+    friend constexpr bool operator>(FixedPoint x, FixedPoint y) { return x.m_value > y.m_value; }
+    friend constexpr bool operator<=(FixedPoint x, FixedPoint y) { return x.m_value <= y.m_value; }
+    friend constexpr bool operator>=(FixedPoint x, FixedPoint y) { return x.m_value >= y.m_value; }
+};
+
+#endif
@@ -1,89 +1,45 @@
 /*  FixedPoint2.cpp
  *
  *  Program to implement a class to hold a value to 2 decimal points.
- *  Range is -32768.99 to 32767.99.
- *  Use 16-bit signed int for integer part, 8-bit signed int for decimal part.
+ *  The class (FixedPoint2.h) stores a 64-bit count of hundredths, so
+ *  arithmetic is exact integer arithmetic.
  *
  */
 
+#include "FixedPoint2.h"
+#include "FixedPointText.h"
+#include <charconv>
+#include <cstddef>
 #include <ios>
 #include <iostream>
-#include <cstdint>
-#include <cmath>
-
-class FixedPoint2
-{
-private:
-    std::int16_t m_integer{ 0 };
-    std::int8_t m_decimal{ 0 };
-
-public:
-    // Default constructor
-    FixedPoint2(std::int16_t integer=0, std::int8_t decimal=0)
-        : m_integer{ integer }, m_decimal{ decimal }
-    {
-        if (m_integer < 0 || m_decimal < 0)
-        {
-            if (m_integer > 0)
-                m_integer = -m_integer;
-            if (m_decimal > 0)
-                m_decimal = -m_decimal;
-        }
-    }
-
-    // Constructor for double
-    FixedPoint2(double value=0.0)
-    {
-        m_integer = static_cast<std::int16_t>(std::trunc(value));
-        m_decimal =static_cast<std::int8_t>(std::round(value * 100) - (m_integer * 100)); 
-    }
-
-    // Overload conversion FixedPoint2 -> double
-    operator double() const
-    {
-        return m_integer + (static_cast<double>(m_decimal) / 100);
-    }
-
-    // Overload operators
-    friend bool operator==(const FixedPoint2& x, const FixedPoint2& y);
-    FixedPoint2 operator-();
-    FixedPoint2 operator+();
-
-};
 
+// Exact decimal text, see FixedPointText.h
 std::ostream& operator<<(std::ostream& out, const FixedPoint2& value)
-    {
-        out << static_cast<double>(value);
-        return out;
-    }
-
-std::istream& operator>>(std::istream& in, FixedPoint2& value)
 {
-    double d{};
-    in >> d;
-    value = FixedPoint2{ d };
-    return in;
+    char buffer[FixedPointText::max_chars<FixedPoint2::Raw, 2>];
+    std::to_chars_result result{ FixedPointText::toChars(buffer, buffer + sizeof(buffer), value) };
+    return out.write(buffer, result.ptr - buffer);
 }
 
-FixedPoint2 operator+(const FixedPoint2& x, const FixedPoint2& y)
+std::istream& operator>>(std::istream& in, FixedPoint2& value)
 {
-    return { static_cast<double>(x) + static_cast<double>(y) };
-}
-
-bool operator==(const FixedPoint2& x, const FixedPoint2& y)
-    {
-        return (x.m_integer == y.m_integer && x.m_decimal == y.m_decimal);
-    }
-
-FixedPoint2 FixedPoint2::operator-()
+    // Takes the characters a number can hold, then parses them without double
+    char buffer[64]{};
+    std::size_t length{ 0 };
+    in >> std::ws;
+    while (length < sizeof(buffer))
     {
-        return { static_cast<std::int16_t>(-m_integer), static_cast<std::int8_t>(-m_decimal) };
+        int ch{ in.peek() };
+        if (!((ch >= '0' && ch <= '9') || ch == '-' || ch == '+' || ch == '.'))
+            break;
+        buffer[length++] = static_cast<char>(in.get());
     }
 
-FixedPoint2 FixedPoint2::operator+()
-    {
-        return { static_cast<std::int16_t>(m_integer), static_cast<std::int8_t>(m_decimal) };
-    }
+    std::from_chars_result result{ FixedPointText::fromChars(buffer, buffer + length, value) };
+    if (result.ec != std::errc{} || result.ptr != buffer + length)
+        in.setstate(std::ios_base::failbit);
+    return in;
+}
 
 void testAddition()
 {
@@ -98,6 +54,43 @@ void testAddition()
     std::cout << (FixedPoint2{ -0.75 } + FixedPoint2{ 1.50 } == FixedPoint2{ 0.75 }) << '\n';
 }
 
+void testArithmetic()
+{
+    using Rounding = FixedPoint2::Rounding;
+
+    // Exact, so no 5.009999... and checkable at compile time
+    static_assert(FixedPoint2{ 5.01 }.getRaw() == 501);
+    static_assert(FixedPoint2{ 0.1 } + FixedPoint2{ 0.2 } == FixedPoint2{ 0.3 });
+    static_assert(FixedPoint2{ 1, 50 } * FixedPoint2{ 2, 25 } == FixedPoint2{ 3, 38 });    // 3.375
+    static_assert(FixedPoint2{ 10, 0 } / FixedPoint2{ 3, 0 } == FixedPoint2{ 3, 33 });
+
+    std::cout << (FixedPoint2{ 0.75 } - FixedPoint2{ 1.23 } == FixedPoint2{ -0.48 }) << '\n';
+    std::cout << (FixedPoint2{ -1.5 } * FixedPoint2{ 2.25 } == FixedPoint2{ -3.38 }) << '\n';
+    std::cout << (FixedPoint2{ 2.0 } / FixedPoint2{ 3.0 } == FixedPoint2{ 0.67 }) << '\n';
+    std::cout << (FixedPoint2{ 1.99 } * 3 == FixedPoint2{ 5.97 } && FixedPoint2{ 10.0 } / 4 == FixedPoint2{ 2.5 }) << '\n';
+
+    // 1.50 * 2.25 = 3.375, -2.0 / 3 = -0.666...
+    FixedPoint2 x{ 1.5 };
+    FixedPoint2 y{ 2.25 };
+    std::cout << (FixedPoint2::multiply(x, y, Rounding::towardZero) == FixedPoint2{ 3.37 }) << ' '
+              << (FixedPoint2::multiply(x, y, Rounding::up) == FixedPoint2{ 3.38 }) << ' '
+              << (FixedPoint2::multiply(x, y, Rounding::halfEven) == FixedPoint2{ 3.38 }) << ' '
+              << (FixedPoint2::multiply(x, FixedPoint2{ 2.15 }, Rounding::halfEven) == FixedPoint2{ 3.22 }) << ' '
+              << (FixedPoint2::divide(FixedPoint2{ -2.0 }, FixedPoint2{ 3.0 }, Rounding::down) == FixedPoint2{ -0.67 }) << ' '
+              << (FixedPoint2::divide(FixedPoint2{ -2.0 }, FixedPoint2{ 3.0 }, Rounding::towardZero) == FixedPoint2{ -0.66 })
+              << '\n';
+
+    std::cout << (FixedPoint2{ -0.01 } < FixedPoint2{ 0.0 } && FixedPoint2{ 1.5 } >= FixedPoint2{ 1, 50 }
+                  && FixedPoint2{ 2.0 } != FixedPoint2{ 2.01 }) << '\n';
+
+    // Overflow is reported instead of wrapping
+    FixedPoint2 largest{ FixedPoint2::fromRaw(INT64_MAX) };
+    FixedPoint2 result{};
+    std::cout << !FixedPoint2::tryAdd(largest, FixedPoint2{ 0.01 }, result) << ' '
+              << !FixedPoint2::tryMultiply(largest, FixedPoint2{ 2.0 }, result) << ' '
+              << FixedPoint2::tryMultiply(largest, FixedPoint2{ 0.5 }, result) << '\n';
+}
+
 int main()
 {
     FixedPoint2 a{ 34, 56 };
@@ -124,11 +117,11 @@ int main()
     FixedPoint2 g{ -0.01 };
     std::cout << g << '\n';
 
-    // Rounding error
-    FixedPoint2 h{ 5.01 }; // stored as 5.009999...
+    // Exact: no rounding error
+    FixedPoint2 h{ 5.01 }; // stored as 501 hundredths
     std::cout << h << '\n';
 
-    FixedPoint2 i{ -5.01 }; // stored as -5.009999...
+    FixedPoint2 i{ -5.01 };
     std::cout << i << '\n';
 
     FixedPoint2 j{ 106.9978 };
@@ -138,6 +131,7 @@ int main()
     std::cout << k << '\n';
 
     testAddition();
+    testArithmetic();
 
     FixedPoint2 l{ -0.48 };
     std::cout << l << '\n';
@@ -0,0 +1,10 @@
+#ifndef FIXED_POINT2_H
+#define FIXED_POINT2_H
+
+#include "FixedPoint.h"
+#include <cstdint>
+
+// Value to 2 decimal places held as a 64-bit count of hundredths
+using FixedPoint2 = FixedPoint<std::int64_t, 2>;
+
+#endif
@@ -0,0 +1,251 @@
+#include "FixedPointBatch.h"
+#include <cstring>
+#include <immintrin.h>
+
+namespace
+{
+    using FixedPointBatch::Int128;
+    using FixedPointBatch::Kernel;
+
+    bool useAvx2(Kernel kernel)
+    {
+        return kernel == Kernel::avx2 && FixedPointBatch::getKernel() == Kernel::avx2;
+    }
+
+    template <typename IntType>
+    Int128 scalarSum(const IntType* values, std::size_t count)
+    {
+        Int128 total{ 0 };
+        for (std::size_t i{ 0 }; i < count; ++i)
+            total += values[i];
+        return total;
+    }
+
+    template <typename IntType>
+    Int128 scalarDot(const IntType* x, const IntType* y, std::size_t count)
+    {
+        Int128 total{ 0 };
+        for (std::size_t i{ 0 }; i < count; ++i)
+            total += static_cast<Int128>(x[i]) * y[i];
+        return total;
+    }
+
+    template <typename IntType>
+    bool scalarScale(const IntType* values, IntType* out, std::size_t count, IntType factor)
+    {
+        bool valid{ true };
+        for (std::size_t i{ 0 }; i < count; ++i)
+            valid &= !__builtin_mul_overflow(values[i], factor, &out[i]);
+        return valid;
+    }
+
+    template <typename IntType>
+    void scalarCompare(const IntType* x, const IntType* y, std::int8_t* out, std::size_t count)
+    {
+        for (std::size_t i{ 0 }; i < count; ++i)
+            out[i] = static_cast<std::int8_t>((x[i] > y[i]) - (x[i] < y[i]));
+    }
+
+    __attribute__((target("avx2")))
+    Int128 sumLanes(__m256i lanes)
+    {
+        alignas(32) std::int64_t parts[4]{};
+        _mm256_store_si256(reinterpret_cast<__m256i*>(parts), lanes);
+        return static_cast<Int128>(parts[0]) + parts[1] + parts[2] + parts[3];
+    }
+
+    // Adds to 64-bit lanes, marking the sign bit of 'overflow' for any lane that wraps
+    __attribute__((target("avx2")))
+    __m256i addChecked(__m256i total, __m256i value, __m256i& overflow)
+    {
+        __m256i sum{ _mm256_add_epi64(total, value) };
+        overflow = _mm256_or_si256(overflow, _mm256_and_si256(_mm256_xor_si256(total, sum), _mm256_xor_si256(value, sum)));
+        return sum;
+    }
+
+    __attribute__((target("avx2")))
+    bool anyOverflow(__m256i overflow)
+    {
+        return _mm256_movemask_pd(_mm256_castsi256_pd(overflow)) != 0;
+    }
+
+    __attribute__((target("avx2")))
+    std::int64_t avx2Sum(const std::int32_t* values, std::size_t count)
+    {
+        // Widened to 64 bits first: 2^32 values cannot overflow
+        __m256i low{ _mm256_setzero_si256() };
+        __m256i high{ _mm256_setzero_si256() };
+        std::size_t i{ 0 };
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i block{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i)) };
+            low = _mm256_add_epi64(low, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(block)));
+            high = _mm256_add_epi64(high, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(block, 1)));
+        }
+        return static_cast<std::int64_t>(sumLanes(_mm256_add_epi64(low, high)) + scalarSum(values + i, count - i));
+    }
+
+    __attribute__((target("avx2")))
+    Int128 avx2Sum(const std::int64_t* values, std::size_t count)
+    {
+        __m256i total{ _mm256_setzero_si256() };
+        __m256i overflow{ _mm256_setzero_si256() };
+        std::size_t i{ 0 };
+        for (; i + 4 <= count; i += 4)
+            total = addChecked(total, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i)), overflow);
+
+        if (anyOverflow(overflow))
+            return scalarSum(values, count);
+        return sumLanes(total) + scalarSum(values + i, count - i);
+    }
+
+    __attribute__((target("avx2")))
+    Int128 avx2Dot(const std::int32_t* x, const std::int32_t* y, std::size_t count)
+    {
+        // 64-bit products of the even and the odd values, in separate totals
+        __m256i even{ _mm256_setzero_si256() };
+        __m256i odd{ _mm256_setzero_si256() };
+        __m256i overflow{ _mm256_setzero_si256() };
+        std::size_t i{ 0 };
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i blockX{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i)) };
+            __m256i blockY{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + i)) };
+            even = addChecked(even, _mm256_mul_epi32(blockX, blockY), overflow);
+            odd = addChecked(odd, _mm256_mul_epi32(_mm256_srli_epi64(blockX, 32), _mm256_srli_epi64(blockY, 32)), overflow);
+        }
+
+        if (anyOverflow(overflow))
+            return scalarDot(x, y, count);
+        return sumLanes(even) + sumLanes(odd) + scalarDot(x + i, y + i, count - i);
+    }
+
+    // Marks the 64-bit lanes of 'products' whose high half is not the sign of the low half
+    __attribute__((target("avx2")))
+    __m256i wideProducts(__m256i products)
+    {
+        __m256i signs{ _mm256_slli_epi64(_mm256_srai_epi32(products, 31), 32) };
+        __m256i highHalves{ _mm256_and_si256(products, _mm256_set1_epi64x(static_cast<long long>(0xFFFFFFFF00000000ull))) };
+        return _mm256_xor_si256(signs, highHalves);
+    }
+
+    __attribute__((target("avx2")))
+    bool avx2Scale(const std::int32_t* values, std::int32_t* out, std::size_t count, std::int32_t factor)
+    {
+        __m256i multiplier{ _mm256_set1_epi32(factor) };
+        __m256i overflow{ _mm256_setzero_si256() };
+        std::size_t i{ 0 };
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i block{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i)) };
+            overflow = _mm256_or_si256(overflow, wideProducts(_mm256_mul_epi32(block, multiplier)));
+            overflow = _mm256_or_si256(overflow, wideProducts(_mm256_mul_epi32(_mm256_srli_epi64(block, 32), multiplier)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_mullo_epi32(block, multiplier));
+        }
+        bool valid{ scalarScale(values + i, out + i, count - i, factor) };
+        return _mm256_testz_si256(overflow, overflow) && valid;
+    }
+
+    __attribute__((target("avx2")))
+    void avx2Compare(const std::int32_t* x, const std::int32_t* y, std::int8_t* out, std::size_t count)
+    {
+        std::size_t i{ 0 };
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i blockX{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i)) };
+            __m256i blockY{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + i)) };
+
+            // Greater gives -1, so less - greater is the sign of x - y
+            __m256i signs{ _mm256_sub_epi32(_mm256_cmpgt_epi32(blockY, blockX), _mm256_cmpgt_epi32(blockX, blockY)) };
+            signs = _mm256_packs_epi32(signs, signs);
+            signs = _mm256_packs_epi16(signs, signs);
+
+            // Bytes 0-3 of each 128-bit lane hold values 0-3 and 4-7
+            std::int32_t low{ _mm256_extract_epi32(signs, 0) };
+            std::int32_t high{ _mm256_extract_epi32(signs, 4) };
+            std::memcpy(out + i, &low, 4);
+            std::memcpy(out + i + 4, &high, 4);
+        }
+        scalarCompare(x + i, y + i, out + i, count - i);
+    }
+
+    __attribute__((target("avx2")))
+    void avx2Compare(const std::int64_t* x, const std::int64_t* y, std::int8_t* out, std::size_t count)
+    {
+        std::size_t i{ 0 };
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256i blockX{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i)) };
+            __m256i blockY{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + i)) };
+            int greater{ _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(blockX, blockY))) };
+            int less{ _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(blockY, blockX))) };
+            for (int lane{ 0 }; lane < 4; ++lane)
+                out[i + lane] = static_cast<std::int8_t>(((greater >> lane) & 1) - ((less >> lane) & 1));
+        }
+        scalarCompare(x + i, y + i, out + i, count - i);
+    }
+}
+
+namespace FixedPointBatch
+{
+    Kernel getKernel()
+    {
+        static const Kernel best{ __builtin_cpu_supports("avx2") ? Kernel::avx2 : Kernel::scalar };
+        return best;
+    }
+
+    std::int64_t sumRaw(const std::int32_t* values, std::size_t count, Kernel kernel)
+    {
+        if (useAvx2(kernel))
+            return avx2Sum(values, count);
+        return static_cast<std::int64_t>(scalarSum(values, count));
+    }
+
+    Int128 sumRaw(const std::int64_t* values, std::size_t count, Kernel kernel)
+    {
+        if (useAvx2(kernel))
+            return avx2Sum(values, count);
+        return scalarSum(values, count);
+    }
+
+    Int128 dotRaw(const std::int32_t* x, const std::int32_t* y, std::size_t count, Kernel kernel)
+    {
+        if (useAvx2(kernel))
+            return avx2Dot(x, y, count);
+        return scalarDot(x, y, count);
+    }
+
+    // AVX2 has no 64-bit multiply, so always the 128-bit scalar loop
+    Int128 dotRaw(const std::int64_t* x, const std::int64_t* y, std::size_t count, Kernel)
+    {
+        return scalarDot(x, y, count);
+    }
+
+    bool scaleRaw(const std::int32_t* values, std::int32_t* out, std::size_t count, std::int32_t factor, Kernel kernel)
+    {
+        if (useAvx2(kernel))
+            return avx2Scale(values, out, count, factor);
+        return scalarScale(values, out, count, factor);
+    }
+
+    bool scaleRaw(const std::int64_t* values, std::int64_t* out, std::size_t count, std::int64_t factor, Kernel)
+    {
+        return scalarScale(values, out, count, factor);
+    }
+
+    void compareRaw(const std::int32_t* x, const std::int32_t* y, std::int8_t* out, std::size_t count, Kernel kernel)
+    {
+        if (useAvx2(kernel))
+            avx2Compare(x, y, out, count);
+        else
+            scalarCompare(x, y, out, count);
+    }
+
+    void compareRaw(const std::int64_t* x, const std::int64_t* y, std::int8_t* out, std::size_t count, Kernel kernel)
+    {
+        if (useAvx2(kernel))
+            avx2Compare(x, y, out, count);
+        else
+            scalarCompare(x, y, out, count);
+    }
+}
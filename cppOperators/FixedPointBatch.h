@@ -0,0 +1,102 @@
+#ifndef FIXED_POINT_BATCH_H
+#define FIXED_POINT_BATCH_H
+
+#include "FixedPoint.h"
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Column operations over arrays of 32- or 64-bit FixedPoint values, working
+// on the stored integers: AVX2 handles 8 (32-bit) or 4 (64-bit) values per
+// instruction. The kernel is picked at run time, so no special compiler
+// flags are needed, and falls back to plain loops on older CPUs.
+//
+// Sums and dot products are exact: nothing is rounded until the end, and a
+// 64-bit lane that would overflow sends the batch to a 128-bit scalar loop.
+namespace FixedPointBatch
+{
+    __extension__ typedef __int128 Int128;
+
+    enum class Kernel
+    {
+        scalar,
+        avx2,
+    };
+
+    // Best kernel this CPU supports
+    Kernel getKernel();
+
+    // Kernels on the stored integers
+    std::int64_t sumRaw(const std::int32_t* values, std::size_t count, Kernel kernel);
+    Int128 sumRaw(const std::int64_t* values, std::size_t count, Kernel kernel);
+
+    Int128 dotRaw(const std::int32_t* x, const std::int32_t* y, std::size_t count, Kernel kernel);
+    Int128 dotRaw(const std::int64_t* x, const std::int64_t* y, std::size_t count, Kernel kernel);
+
+    // out[i] = values[i] * factor; false if any product overflows
+    bool scaleRaw(const std::int32_t* values, std::int32_t* out, std::size_t count, std::int32_t factor, Kernel kernel);
+    bool scaleRaw(const std::int64_t* values, std::int64_t* out, std::size_t count, std::int64_t factor, Kernel kernel);
+
+    // out[i] = -1, 0 or 1 as x[i] is less than, equal to or greater than y[i]
+    void compareRaw(const std::int32_t* x, const std::int32_t* y, std::int8_t* out, std::size_t count, Kernel kernel);
+    void compareRaw(const std::int64_t* x, const std::int64_t* y, std::int8_t* out, std::size_t count, Kernel kernel);
+
+    template <typename IntType, int DecimalDigits>
+    const IntType* getRaw(const FixedPoint<IntType, DecimalDigits>* values)
+    {
+        static_assert(std::is_same_v<IntType, std::int32_t> || std::is_same_v<IntType, std::int64_t>,
+                      "Batch kernels take 32- or 64-bit FixedPoint values.");
+        static_assert(sizeof(FixedPoint<IntType, DecimalDigits>) == sizeof(IntType)
+                      && std::is_standard_layout_v<FixedPoint<IntType, DecimalDigits>>);
+        return reinterpret_cast<const IntType*>(values);
+    }
+
+    template <typename IntType, int DecimalDigits>
+    IntType* getRaw(FixedPoint<IntType, DecimalDigits>* values)
+    {
+        return const_cast<IntType*>(getRaw(static_cast<const FixedPoint<IntType, DecimalDigits>*>(values)));
+    }
+
+    // Total of a column, as a 64-bit value so that 32-bit columns cannot overflow
+    template <typename IntType, int DecimalDigits>
+    FixedPoint<std::int64_t, DecimalDigits> sum(const FixedPoint<IntType, DecimalDigits>* values, std::size_t count,
+                                                Kernel kernel = getKernel())
+    {
+        Int128 total{ sumRaw(getRaw(values), count, kernel) };
+        assert(total >= INT64_MIN && total <= INT64_MAX && "FixedPoint overflow.");
+        return FixedPoint<std::int64_t, DecimalDigits>::fromRaw(static_cast<std::int64_t>(total));
+    }
+
+    // Sum of x[i] * y[i], rounded once at the end
+    template <typename IntType, int DecimalDigits>
+    FixedPoint<std::int64_t, DecimalDigits> dot(const FixedPoint<IntType, DecimalDigits>* x,
+                                                const FixedPoint<IntType, DecimalDigits>* y, std::size_t count,
+                                                FixedPointRounding rounding = FixedPointRounding::halfAwayFromZero,
+                                                Kernel kernel = getKernel())
+    {
+        using Result = FixedPoint<std::int64_t, DecimalDigits>;
+        Int128 total{ Result::divideRounded(dotRaw(getRaw(x), getRaw(y), count, kernel), Result::scale, rounding) };
+        assert(total >= INT64_MIN && total <= INT64_MAX && "FixedPoint overflow.");
+        return Result::fromRaw(static_cast<std::int64_t>(total));
+    }
+
+    // out[i] = values[i] * factor (exact; out may be values)
+    template <typename IntType, int DecimalDigits>
+    void scale(const FixedPoint<IntType, DecimalDigits>* values, FixedPoint<IntType, DecimalDigits>* out,
+               std::size_t count, IntType factor, Kernel kernel = getKernel())
+    {
+        bool valid{ scaleRaw(getRaw(values), getRaw(out), count, factor, kernel) };
+        assert(valid && "FixedPoint overflow.");
+        (void)valid;
+    }
+
+    template <typename IntType, int DecimalDigits>
+    void compare(const FixedPoint<IntType, DecimalDigits>* x, const FixedPoint<IntType, DecimalDigits>* y,
+                 std::int8_t* out, std::size_t count, Kernel kernel = getKernel())
+    {
+        compareRaw(getRaw(x), getRaw(y), out, count, kernel);
+    }
+}
+
+#endif
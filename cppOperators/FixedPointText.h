@@ -0,0 +1,229 @@
+#ifndef FIXED_POINT_TEXT_H
+#define FIXED_POINT_TEXT_H
+
+#include "FixedPoint.h"
+#include <charconv>
+#include <cstddef>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+// Decimal text to and from FixedPoint, straight to and from the stored
+// integer: no double, no streams, no locale and no allocation. Same
+// conventions as std::from_chars and std::to_chars.
+//
+// Accepted text is an optional sign, digits, and optionally a '.' and more
+// digits ("12", "-0.5", "+3.", ".25"). Digits past the last decimal place
+// are rounded away with the given rounding; the value is formatted with
+// every decimal place ("12.00", "-0.50").
+namespace FixedPointText
+{
+    // Longest formatted value: sign, every digit and the point
+    template <typename IntType, int DecimalDigits>
+    inline constexpr int max_chars{ std::numeric_limits<IntType>::digits10 + 3 };
+
+    // "00" to "99", so formatting divides by 100 rather than 10
+    struct DigitPairs
+    {
+        char text[200]{};
+
+        constexpr DigitPairs()
+        {
+            for (int pair{ 0 }; pair < 100; ++pair)
+            {
+                text[2 * pair] = static_cast<char>('0' + pair / 10);
+                text[2 * pair + 1] = static_cast<char>('0' + pair % 10);
+            }
+        }
+    };
+
+    inline constexpr DigitPairs digit_pairs{};
+
+    template <typename IntType, int DecimalDigits>
+    std::from_chars_result fromChars(const char* first, const char* last, FixedPoint<IntType, DecimalDigits>& value,
+                                     FixedPointRounding rounding = FixedPointRounding::halfAwayFromZero)
+    {
+        using Unsigned = std::make_unsigned_t<IntType>;
+
+        const char* ptr{ first };
+        bool negative{ false };
+        if (ptr != last && (*ptr == '-' || *ptr == '+'))
+        {
+            negative = (*ptr == '-');
+            ++ptr;
+        }
+
+        // Magnitude in units of the last decimal place; only digits past
+        // the first digits10 can overflow, so only those are checked
+        Unsigned units{ 0 };
+        bool overflow{ false };
+        int kept{ 0 };
+        auto addDigit{ [&units, &overflow, &kept](int digit) {
+            if (kept++ < std::numeric_limits<Unsigned>::digits10)
+                units = static_cast<Unsigned>(units * 10 + static_cast<Unsigned>(digit));
+            else
+            {
+                overflow |= __builtin_mul_overflow(units, Unsigned{ 10 }, &units);
+                overflow |= __builtin_add_overflow(units, static_cast<Unsigned>(digit), &units);
+            }
+        } };
+
+        int digits{ 0 };
+        for (; ptr != last && *ptr >= '0' && *ptr <= '9'; ++ptr, ++digits)
+            addDigit(*ptr - '0');
+
+        int places{ 0 };
+        int firstDropped{ 0 };      // first digit past the last decimal place
+        bool moreDropped{ false };  // any non-zero digit after that
+        if (ptr != last && *ptr == '.')
+        {
+            for (++ptr; ptr != last && *ptr >= '0' && *ptr <= '9'; ++ptr, ++digits)
+            {
+                int digit{ *ptr - '0' };
+                if (places < DecimalDigits)
+                {
+                    addDigit(digit);
+                    ++places;
+                }
+                else if (places == DecimalDigits)
+                {
+                    firstDropped = digit;
+                    ++places;
+                }
+                else
+                    moreDropped |= (digit != 0);
+            }
+        }
+
+        if (digits == 0)
+            return { first, std::errc::invalid_argument };
+
+        for (; places < DecimalDigits; ++places)
+            addDigit(0);
+
+        bool dropped{ firstDropped != 0 || moreDropped };
+        bool roundUp{ false };  // away from zero
+        switch (rounding)
+        {
+        case FixedPointRounding::towardZero:
+            break;
+        case FixedPointRounding::down:
+            roundUp = negative && dropped;
+            break;
+        case FixedPointRounding::up:
+            roundUp = !negative && dropped;
+            break;
+        case FixedPointRounding::halfAwayFromZero:
+            roundUp = firstDropped >= 5;
+            break;
+        case FixedPointRounding::halfEven:
+            roundUp = firstDropped > 5 || (firstDropped == 5 && (moreDropped || units % 2 != 0));
+            break;
+        }
+        if (roundUp)
+            overflow |= __builtin_add_overflow(units, Unsigned{ 1 }, &units);
+
+        // Negative values go one further than positive ones
+        Unsigned limit{ static_cast<Unsigned>(static_cast<Unsigned>(std::numeric_limits<IntType>::max()) + (negative ? 1 : 0)) };
+        if (overflow || units > limit)
+            return { ptr, std::errc::result_out_of_range };
+
+        value = FixedPoint<IntType, DecimalDigits>::fromRaw(static_cast<IntType>(negative ? Unsigned{ 0 } - units : units));
+        return { ptr, std::errc{} };
+    }
+
+    template <typename IntType, int DecimalDigits>
+    std::to_chars_result toChars(char* first, char* last, FixedPoint<IntType, DecimalDigits> value)
+    {
+        using Unsigned = std::make_unsigned_t<IntType>;
+
+        IntType raw{ value.getRaw() };
+        Unsigned units{ static_cast<Unsigned>(raw < 0 ? Unsigned{ 0 } - static_cast<Unsigned>(raw) : static_cast<Unsigned>(raw)) };
+
+        // Digits from the right, two at a time, then the point moved in
+        // front of the last DecimalDigits of them
+        char buffer[max_chars<IntType, DecimalDigits>];
+        char* end{ buffer + sizeof(buffer) };
+        char* begin{ end };
+        for (; units >= 100; units /= 100)
+        {
+            begin -= 2;
+            begin[0] = digit_pairs.text[2 * (units % 100)];
+            begin[1] = digit_pairs.text[2 * (units % 100) + 1];
+        }
+        if (units >= 10)
+        {
+            begin -= 2;
+            begin[0] = digit_pairs.text[2 * units];
+            begin[1] = digit_pairs.text[2 * units + 1];
+        }
+        else
+            *--begin = static_cast<char>('0' + units);
+
+        if constexpr (DecimalDigits > 0)
+        {
+            while (end - begin <= DecimalDigits)
+                *--begin = '0';
+            for (char* digit{ begin - 1 }; digit < end - DecimalDigits - 1; ++digit)
+                digit[0] = digit[1];
+            --begin;
+            end[-DecimalDigits - 1] = '.';
+        }
+        if (raw < 0)
+            *--begin = '-';
+
+        if (last - first < end - begin)
+            return { last, std::errc::value_too_large };
+        for (; begin != end; ++begin, ++first)
+            *first = *begin;
+        return { first, std::errc{} };
+    }
+
+    // Where bulk parsing stopped: after 'count' values, at 'ptr', with ec set
+    // if the line at ptr is malformed
+    struct BulkResult
+    {
+        std::size_t count{ 0 };
+        const char* ptr{ nullptr };
+        std::errc ec{};
+    };
+
+    // One value per line ('\n' or "\r\n" endings), blank lines skipped, into
+    // out[0..capacity). Stops at the end of the text, a malformed line or a
+    // full output; in the last case ptr is where to carry on.
+    template <typename IntType, int DecimalDigits>
+    BulkResult parseLines(const char* first, const char* last, FixedPoint<IntType, DecimalDigits>* out,
+                          std::size_t capacity, FixedPointRounding rounding = FixedPointRounding::halfAwayFromZero)
+    {
+        BulkResult result{ 0, first, std::errc{} };
+        const char* ptr{ first };
+        while (ptr != last && result.count < capacity)
+        {
+            if (*ptr == '\n' || *ptr == '\r')
+            {
+                ++ptr;
+                continue;
+            }
+
+            std::from_chars_result parsed{ fromChars(ptr, last, out[result.count], rounding) };
+            if (parsed.ec == std::errc{} && parsed.ptr != last && *parsed.ptr == '\r')
+                ++parsed.ptr;
+            if (parsed.ec == std::errc{} && parsed.ptr != last && *parsed.ptr != '\n')
+                parsed.ec = std::errc::invalid_argument;
+            if (parsed.ec != std::errc{})
+            {
+                result.ptr = ptr;
+                result.ec = parsed.ec;
+                return result;
+            }
+
+            ++result.count;
+            ptr = parsed.ptr;
+        }
+
+        result.ptr = ptr;
+        return result;
+    }
+}
+
+#endif
@@ -0,0 +1,266 @@
+#ifndef FRACTION_H
+#define FRACTION_H
+
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+
+// Exact rational number numerator/denominator in an IntType.
+//
+// Every result is worked out in an integer twice as wide (128 bits for
+// 64-bit fractions), so products never overflow on the way. Fractions are
+// not kept in lowest terms: a result is only reduced when it does not fit
+// IntType as it stands, and when it is printed or its parts are asked for.
+// Comparisons cross-multiply in the wide integer, so 2/4 == 1/2.
+//
+// Results that do not fit even in lowest terms fail an assert; tryAdd()
+// and friends report that instead.
+template <typename IntType>
+class BasicFraction
+{
+    static_assert(std::is_integral_v<IntType> && std::is_signed_v<IntType> && sizeof(IntType) <= 8,
+                  "Fraction needs a signed integer of up to 64 bits.");
+
+public:
+    __extension__ typedef __int128 Int128;
+    __extension__ typedef unsigned __int128 UInt128;
+    using Wide = std::conditional_t<(sizeof(IntType) <= 4), std::int64_t, Int128>;
+    using UnsignedWide = std::conditional_t<(sizeof(IntType) <= 4), std::uint64_t, UInt128>;
+
+    // Binary (Stein's) GCD: shifts and subtractions instead of divisions.
+    // The next shift is counted from the difference before it is made
+    // positive, so it does not wait for the comparison (the top bit keeps
+    // the count defined once the difference reaches 0).
+    template <typename Unsigned>
+    static constexpr Unsigned gcd(Unsigned a, Unsigned b)
+    {
+        if (a == 0)
+            return b;
+        if (b == 0)
+            return a;
+
+        constexpr Unsigned top_bit{ static_cast<Unsigned>(Unsigned{ 1 } << (8 * sizeof(Unsigned) - 1)) };
+        int shiftA{ countTrailingZeros(a) };
+        int shiftB{ countTrailingZeros(b) };
+        int common{ shiftA < shiftB ? shiftA : shiftB };
+        b >>= shiftB;
+        while (a != 0)
+        {
+            a >>= shiftA;
+            Unsigned difference{ static_cast<Unsigned>(b - a) };
+            shiftA = countTrailingZeros(static_cast<Unsigned>(difference | top_bit));
+            Unsigned smaller{ a < b ? a : b };
+            a = a < b ? difference : static_cast<Unsigned>(a - b);
+            b = smaller;
+        }
+        return b << common;
+    }
+
+private:
+    IntType m_numerator{ 0 };
+    IntType m_denominator{ 1 };     // always positive
+
+    // 0/1 without going through make()
+    struct Zero {};
+    constexpr explicit BasicFraction(Zero) {}
+
+    // Not for 0
+    template <typename Unsigned>
+    static constexpr int countTrailingZeros(Unsigned value)
+    {
+        if constexpr (sizeof(Unsigned) <= 8)
+            return __builtin_ctzll(value);
+        else
+        {
+            auto low{ static_cast<std::uint64_t>(value) };
+            return low ? __builtin_ctzll(low) : 64 + __builtin_ctzll(static_cast<std::uint64_t>(value >> 64));
+        }
+    }
+
+    static constexpr UnsignedWide magnitude(Wide value)
+    {
+        return value < 0 ? UnsignedWide{ 0 } - static_cast<UnsignedWide>(value) : static_cast<UnsignedWide>(value);
+    }
+
+    // In 64 bits when both fit, which is much faster than 128
+    static constexpr UnsignedWide wideGcd(UnsignedWide a, UnsignedWide b)
+    {
+        if ((a | b) <= UINT64_MAX)
+            return gcd(static_cast<std::uint64_t>(a), static_cast<std::uint64_t>(b));
+        return gcd(a, b);
+    }
+
+    static constexpr bool fits(Wide value)
+    {
+        return value >= std::numeric_limits<IntType>::min() && value <= std::numeric_limits<IntType>::max();
+    }
+
+    // Stores numerator/denominator, reducing it only if it does not fit as it is
+    static constexpr bool tryMake(Wide numerator, Wide denominator, BasicFraction& result)
+    {
+        if (denominator == 0)
+            return false;
+        if (denominator < 0)
+        {
+            numerator = -numerator;
+            denominator = -denominator;
+        }
+
+        if (!fits(numerator) || !fits(denominator))
+        {
+            auto divisor{ static_cast<Wide>(wideGcd(magnitude(numerator), static_cast<UnsignedWide>(denominator))) };
+            numerator /= divisor;
+            denominator /= divisor;
+            if (!fits(numerator) || !fits(denominator))
+                return false;
+        }
+
+        result.m_numerator = static_cast<IntType>(numerator);
+        result.m_denominator = static_cast<IntType>(denominator);
+        return true;
+    }
+
+    static constexpr BasicFraction make(Wide numerator, Wide denominator)
+    {
+        assert(denominator != 0 && "Divide by zero");
+        BasicFraction result{ Zero{} };
+        bool valid{ tryMake(numerator, denominator, result) };
+        assert(valid && "Fraction overflow.");
+        (void)valid;
+        return result;
+    }
+
+    // Sign of f1 - f2
+    static constexpr int compare(const BasicFraction& f1, const BasicFraction& f2)
+    {
+        Wide left{ static_cast<Wide>(f1.m_numerator) * f2.m_denominator };
+        Wide right{ static_cast<Wide>(f2.m_numerator) * f1.m_denominator };
+        return (left > right) - (left < right);
+    }
+
+public:
+    constexpr BasicFraction(IntType numerator = 0, IntType denominator = 1)
+        : BasicFraction{ make(numerator, denominator) }
+    {}
+
+    // Lowest terms
+    constexpr void reduce()
+    {
+        auto divisor{ static_cast<IntType>(gcd(static_cast<std::uint64_t>(magnitude(m_numerator)),
+                                               static_cast<std::uint64_t>(m_denominator))) };
+        m_numerator /= divisor;
+        m_denominator /= divisor;
+    }
+
+    constexpr BasicFraction reduced() const
+    {
+        BasicFraction result{ *this };
+        result.reduce();
+        return result;
+    }
+
+    constexpr IntType getNumerator() const { return reduced().m_numerator; }
+    constexpr IntType getDenominator() const { return reduced().m_denominator; }
+
+    constexpr explicit operator double() const
+    {
+        return static_cast<double>(m_numerator) / static_cast<double>(m_denominator);
+    }
+
+    void print() const
+    {
+        std::cout << *this << '\n';
+    }
+
+    // Checked arithmetic: false (and result untouched) if even the reduced
+    // result does not fit, or on division by zero
+    static constexpr bool tryAdd(const BasicFraction& f1, const BasicFraction& f2, BasicFraction& result)
+    {
+        return tryMake(static_cast<Wide>(f1.m_numerator) * f2.m_denominator + static_cast<Wide>(f2.m_numerator) * f1.m_denominator,
+                       static_cast<Wide>(f1.m_denominator) * f2.m_denominator, result);
+    }
+
+    static constexpr bool trySubtract(const BasicFraction& f1, const BasicFraction& f2, BasicFraction& result)
+    {
+        return tryMake(static_cast<Wide>(f1.m_numerator) * f2.m_denominator - static_cast<Wide>(f2.m_numerator) * f1.m_denominator,
+                       static_cast<Wide>(f1.m_denominator) * f2.m_denominator, result);
+    }
+
+    static constexpr bool tryMultiply(const BasicFraction& f1, const BasicFraction& f2, BasicFraction& result)
+    {
+        return tryMake(static_cast<Wide>(f1.m_numerator) * f2.m_numerator,
+                       static_cast<Wide>(f1.m_denominator) * f2.m_denominator, result);
+    }
+
+    static constexpr bool tryDivide(const BasicFraction& f1, const BasicFraction& f2, BasicFraction& result)
+    {
+        return tryMake(static_cast<Wide>(f1.m_numerator) * f2.m_denominator,
+                       static_cast<Wide>(f1.m_denominator) * f2.m_numerator, result);
+    }
+
+    constexpr BasicFraction operator-() const { return make(-static_cast<Wide>(m_numerator), m_denominator); }
+    constexpr BasicFraction operator+() const { return *this; }
+
+    constexpr BasicFraction& operator+=(const BasicFraction& f2)
+    {
+        return *this = make(static_cast<Wide>(m_numerator) * f2.m_denominator + static_cast<Wide>(f2.m_numerator) * m_denominator,
+                            static_cast<Wide>(m_denominator) * f2.m_denominator);
+    }
+
+    constexpr BasicFraction& operator-=(const BasicFraction& f2)
+    {
+        return *this = make(static_cast<Wide>(m_numerator) * f2.m_denominator - static_cast<Wide>(f2.m_numerator) * m_denominator,
+                            static_cast<Wide>(m_denominator) * f2.m_denominator);
+    }
+
+    constexpr BasicFraction& operator*=(const BasicFraction& f2)
+    {
+        return *this = make(static_cast<Wide>(m_numerator) * f2.m_numerator, static_cast<Wide>(m_denominator) * f2.m_denominator);
+    }
+
+    constexpr BasicFraction& operator/=(const BasicFraction& f2)
+    {
+        return *this = make(static_cast<Wide>(m_numerator) * f2.m_denominator, static_cast<Wide>(m_denominator) * f2.m_numerator);
+    }
+
+    // Integers convert implicitly, so f1 * 2 and 2 * f1 work too
+    friend constexpr BasicFraction operator+(BasicFraction f1, const BasicFraction& f2) { return f1 += f2; }
+    friend constexpr BasicFraction operator-(BasicFraction f1, const BasicFraction& f2) { return f1 -= f2; }
+    friend constexpr BasicFraction operator*(BasicFraction f1, const BasicFraction& f2) { return f1 *= f2; }
+    friend constexpr BasicFraction operator/(BasicFraction f1, const BasicFraction& f2) { return f1 /= f2; }
+
+    friend constexpr bool operator==(const BasicFraction& f1, const BasicFraction& f2) { return compare(f1, f2) == 0; }
+    friend constexpr bool operator!=(const BasicFraction& f1, const BasicFraction& f2) { return compare(f1, f2) != 0; }
+    friend constexpr bool operator<(const BasicFraction& f1, const BasicFraction& f2) { return compare(f1, f2) < 0; }
+    friend constexpr bool operator>(const BasicFraction& f1, const BasicFraction& f2) { return compare(f1, f2) > 0; }
+    friend constexpr bool operator<=(const BasicFraction& f1, const BasicFraction& f2) { return compare(f1, f2) <= 0; }
+    friend constexpr bool operator>=(const BasicFraction& f1, const BasicFraction& f2) { return compare(f1, f2) >= 0; }
+
+    friend std::ostream& operator<<(std::ostream& out, const BasicFraction& f1)
+    {
+        BasicFraction lowest{ f1.reduced() };
+        out << static_cast<long long>(lowest.m_numerator) << '/' << static_cast<long long>(lowest.m_denominator);
+        return out;
+    }
+
+    friend std::istream& operator>>(std::istream& in, BasicFraction& f1)
+    {
+        long long numerator{ 0 };
+        long long denominator{ 1 };
+        in >> numerator;
+        in.ignore(std::numeric_limits<std::streamsize>::max(), '/');
+        in >> denominator;
+
+        if (denominator == 0 || !fits(numerator) || !fits(denominator))
+            in.setstate(std::ios_base::failbit);
+        else
+            f1 = make(numerator, denominator);
+        return in;
+    }
+};
+
+using Fraction = BasicFraction<int>;
+
+#endif
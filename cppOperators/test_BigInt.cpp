@@ -0,0 +1,155 @@
+#include "BigInt.h"
+#include "../cppCommon/Random.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    // Random magnitude of about 'limbs' limbs, negative half the time
+    BigInt randomBig(Random::Generator& gen, std::size_t limbs)
+    {
+        BigInt value{};
+        for (std::size_t i{ 0 }; i < limbs; ++i)
+        {
+            value <<= 64;
+            value += BigInt{ static_cast<long long>(gen() >> 1) } * 2 + BigInt{ static_cast<long long>(gen() & 1) };
+        }
+        return (gen() & 1) ? -value : value;
+    }
+
+    BigInt factorial(int n)
+    {
+        BigInt result{ 1 };
+        for (int i{ 2 }; i <= n; ++i)
+            result *= i;
+        return result;
+    }
+
+    // Plain Euclid, one long division per step
+    BigInt euclid(BigInt a, BigInt b)
+    {
+        a = a.abs();
+        b = b.abs();
+        while (!b.isZero())
+        {
+            BigInt remainder{ a % b };
+            a = std::move(b);
+            b = std::move(remainder);
+        }
+        return a;
+    }
+}
+
+int main()
+{
+    std::cout << std::boolalpha;
+    Random::Generator gen{ Random::getStream(25, 0) };
+
+    // Known values, and text both ways
+    BigInt two128{ BigInt{ 1 } << 128 };
+    std::cout << (two128.toString() == "340282366920938463463374607431768211456") << ' '
+              << (factorial(30).toString() == "265252859812191058636308480000000") << ' '
+              << (BigInt{ "-265252859812191058636308480000000" } == -factorial(30)) << ' '
+              << (BigInt{ INT64_MIN }.toString() == "-9223372036854775808") << ' '
+              << (BigInt{ "10000000000000000000" }.toString() == "10000000000000000000") << ' '
+              << (BigInt{ "-0" }.getSign() == 0) << '\n';
+
+    // Up to 128 bits stays in the object
+    std::cout << (BigInt{ INT64_MAX }.getLimbs().isInline() && (two128 - 1).getLimbs().isInline()
+                  && !two128.getLimbs().isInline()) << ' '
+              << (BigInt{ INT64_MIN }.fitsInt64() && BigInt{ INT64_MIN }.toInt64() == INT64_MIN
+                  && !(BigInt{ INT64_MAX } + 1).fitsInt64()) << ' '
+              << (static_cast<double>(factorial(30)) == 265252859812191058636308480000000.0) << '\n';
+
+    // Truncating division like int, including single-limb divisors
+    bool divides{ true };
+    for (long long a : { 7LL, -7LL, 0LL, 123456789012345LL })
+    {
+        for (long long b : { 2LL, -2LL, 7LL, -1000LL })
+            divides = divides && BigInt{ a } / b == a / b && BigInt{ a } % b == a % b;
+    }
+    std::cout << divides << '\n';
+
+    // Random identities across sizes, from inline to a few thousand bits
+    bool exact{ true };
+    for (int i{ 0 }; i < 3000; ++i)
+    {
+        BigInt a{ randomBig(gen, static_cast<std::size_t>(Random::get(gen, 0, 40))) };
+        BigInt b{ randomBig(gen, static_cast<std::size_t>(Random::get(gen, 1, 40))) };
+        if (b.isZero())
+            continue;
+        BigInt quotient{};
+        BigInt remainder{};
+        BigInt::divide(a, b, quotient, remainder);
+        exact = exact && quotient * b + remainder == a && remainder.abs() < b.abs()
+                && (remainder.isZero() || remainder.isNegative() == a.isNegative())
+                && (a * b) / b == a && ((a * b) % b).isZero() && (a + b) - b == a
+                && BigInt{ a.toString() } == a && ((a << 77) >> 77) == a;
+    }
+    std::cout << exact << '\n';
+
+    // Karatsuba against schoolbook, balanced and lopsided
+    bool karatsuba{ true };
+    for (int i{ 0 }; i < 100; ++i)
+    {
+        BigInt a{ randomBig(gen, static_cast<std::size_t>(Random::get(gen, 1, 300))) };
+        BigInt b{ randomBig(gen, static_cast<std::size_t>(Random::get(gen, 1, 300))) };
+        BigInt product{ BigInt::multiply(a, b, 4) };
+        karatsuba = karatsuba && product == BigInt::multiply(a, b, std::numeric_limits<std::size_t>::max())
+                    && product == a * b;
+    }
+    BigInt ones{ (BigInt{ 1 } << 64 * 200) - 1 };
+    std::cout << karatsuba << ' ' << (BigInt::multiply(ones, ones, 4) == BigInt::multiply(ones, ones, 1000)) << '\n';
+
+    // Lehmer against Euclid, with a known common factor
+    bool lehmer{ true };
+    for (int i{ 0 }; i < 300; ++i)
+    {
+        BigInt a{ randomBig(gen, static_cast<std::size_t>(Random::get(gen, 0, 30))) };
+        BigInt b{ randomBig(gen, static_cast<std::size_t>(Random::get(gen, 0, 30))) };
+        BigInt c{ randomBig(gen, static_cast<std::size_t>(Random::get(gen, 1, 10))).abs() };
+        BigInt divisor{ BigInt::gcd(a * c, b * c) };
+        lehmer = lehmer && divisor == euclid(a * c, b * c) && (c.isZero() || divisor % c == 0)
+                 && BigInt::gcd(a, b) == euclid(a, b);
+    }
+    std::cout << lehmer << ' ' << (BigInt::gcd(factorial(100), factorial(60) * 101) == factorial(60)) << '\n';
+
+    std::ostringstream out{};
+    out << -two128;
+    std::cout << (out.str() == "-340282366920938463463374607431768211456") << '\n';
+
+    // Timings
+    BigInt x{ randomBig(gen, 2000) };
+    BigInt y{ randomBig(gen, 2000) };
+    auto start{ std::chrono::steady_clock::now() };
+    BigInt fast{ x * y };
+    std::chrono::duration<double, std::micro> karatsubaTime{ std::chrono::steady_clock::now() - start };
+    start = std::chrono::steady_clock::now();
+    BigInt slow{ BigInt::multiply(x, y, std::numeric_limits<std::size_t>::max()) };
+    std::chrono::duration<double, std::micro> schoolbookTime{ std::chrono::steady_clock::now() - start };
+    std::cout << (fast == slow) << " (2000-limb product: Karatsuba " << karatsubaTime.count() << " us, schoolbook "
+              << schoolbookTime.count() << " us)\n";
+
+    std::vector<BigInt> pairs{};
+    for (int i{ 0 }; i < 200; ++i)
+        pairs.push_back(randomBig(gen, 60));
+    start = std::chrono::steady_clock::now();
+    BigInt check{};
+    for (std::size_t i{ 0 }; i < pairs.size(); i += 2)
+        check += BigInt::gcd(pairs[i], pairs[i + 1]);
+    std::chrono::duration<double, std::micro> lehmerTime{ std::chrono::steady_clock::now() - start };
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i{ 0 }; i < pairs.size(); i += 2)
+        check -= euclid(pairs[i], pairs[i + 1]);
+    std::chrono::duration<double, std::micro> euclidTime{ std::chrono::steady_clock::now() - start };
+    std::cout << check.isZero() << " (60-limb gcd: Lehmer " << lehmerTime.count() / 100 << " us, Euclid "
+              << euclidTime.count() / 100 << " us)\n";
+
+    return 0;
+}
@@ -0,0 +1,120 @@
+#include "BigRational.h"
+#include "../cppCommon/Random.h"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using Fraction64 = BasicFraction<std::int64_t>;
+
+int main()
+{
+    std::cout << std::boolalpha;
+    Random::Generator gen{ Random::getStream(25, 1) };
+
+    // Small values behave like Fraction and stay inline
+    BigRational half{ 1, 2 };
+    BigRational sum{ half + BigRational{ 1, 3 } };
+    std::cout << (sum == BigRational{ 5, 6 } && sum.isSmall()) << ' ' << (BigRational{ 2, -4 } == -half) << ' '
+              << (BigRational{ Fraction{ 6, 8 } } == BigRational{ 3, 4 }) << ' ' << (half * 2 == 1 && 1 / half == 2)
+              << ' ' << (BigRational{ 1, 3 } < half && -half < BigRational{ -1, 3 }) << '\n';
+
+    // Harmonic numbers: a 64-bit Fraction gives out long before 100 terms
+    int fractionTerms{ 0 };
+    Fraction64 harmonic64{};
+    while (Fraction64::tryAdd(harmonic64, Fraction64{ 1, fractionTerms + 1 }, harmonic64))
+        ++fractionTerms;
+
+    constexpr int n_terms{ 100 };
+    BigRational harmonic{};
+    BigInt factorial{ 1 };
+    for (int k{ 1 }; k <= n_terms; ++k)
+    {
+        harmonic += BigRational{ 1, k };
+        factorial *= k;
+    }
+    // The same sum over the common denominator 100!
+    BigInt numerator{};
+    for (int k{ 1 }; k <= n_terms; ++k)
+        numerator += factorial / k;
+    std::cout << (fractionTerms < n_terms) << ' ' << (!harmonic.isSmall() && harmonic == BigRational{ numerator, factorial })
+              << ' ' << (std::abs(static_cast<double>(harmonic) - 5.187377517639621) < 1e-12) << '\n';
+
+    // Big results that reduce back into 64 bits go back inline
+    BigRational back{ harmonic - harmonic + BigRational{ 1, 3 } };
+    BigRational ratio{ harmonic / (harmonic * 7) };
+    std::cout << (back.isSmall() && back == BigRational{ 1, 3 }) << ' ' << (ratio.isSmall() && ratio == BigRational{ 1, 7 })
+              << ' ' << (BigRational{ INT64_MIN, -1 } == BigRational{ BigInt{ INT64_MIN }.abs() }) << ' '
+              << !BigRational{ INT64_MIN, -1 }.isSmall() << '\n';
+
+    // Birthday problem for 60 people: (365/365)(364/365)...(306/365) exactly
+    BigRational noShared{ 1 };
+    double approximate{ 1.0 };
+    BigInt fallingFactorial{ 1 };
+    BigInt power{ 1 };
+    for (int k{ 0 }; k < 60; ++k)
+    {
+        noShared *= BigRational{ 365 - k, 365 };
+        approximate *= (365.0 - k) / 365.0;
+        fallingFactorial *= 365 - k;
+        power *= 365;
+    }
+    std::cout << (noShared == BigRational{ fallingFactorial, power }) << ' '
+              << (std::abs(static_cast<double>(noShared) / approximate - 1) < 1e-12) << ' '
+              << (1 - noShared > BigRational{ 99, 100 }) << '\n';
+
+    // Comparisons across small and big, and printing in lowest terms
+    BigRational huge{ BigInt{ 1 } << 200, BigInt{ 3 } };
+    std::ostringstream out{};
+    out << -huge << ' ' << BigRational{ 10, -4 };
+    std::cout << (huge > BigRational{ INT64_MAX } && -huge < BigRational{ INT64_MIN } && huge != huge + BigRational{ 1, 3 })
+              << ' ' << (out.str() == "-1606938044258990275541962092341162602522202993782792835301376/3 -5/2") << '\n';
+
+    // Random arithmetic against Fraction while it fits, exact past that
+    bool exact{ true };
+    for (int i{ 0 }; i < 20000; ++i)
+    {
+        Fraction64 x{ Random::get(gen, -1000000, 1000000), Random::get(gen, 1, 1000000) };
+        Fraction64 y{ Random::get(gen, -1000000, 1000000), Random::get(gen, 1, 1000000) };
+        BigRational bigX{ x };
+        BigRational bigY{ y };
+        exact = exact && bigX + bigY == BigRational{ x + y } && bigX * bigY == BigRational{ x * y }
+                && (bigX < bigY) == (x < y);
+
+        BigRational scaled{ bigX * huge };
+        exact = exact && scaled / huge == bigX && (scaled + bigY) - scaled == bigY;
+        if (y != 0)
+            exact = exact && (scaled / bigY) * bigY == scaled;
+    }
+    std::cout << exact << '\n';
+
+    // The inline path against the same sums through BigInt
+    constexpr int n_sums{ 1000000 };
+    std::vector<BigRational> terms{};
+    for (int i{ 0 }; i < n_sums; ++i)
+    {
+        int denominator{ Random::get(gen, 1, 12) };
+        terms.push_back(BigRational{ Random::get(gen, 0, denominator), denominator });
+    }
+
+    auto start{ std::chrono::steady_clock::now() };
+    BigRational total{};
+    for (const BigRational& term : terms)
+        total += term;
+    std::chrono::duration<double, std::nano> smallTime{ std::chrono::steady_clock::now() - start };
+
+    BigRational offset{ BigInt{ 1 } << 100 };
+    start = std::chrono::steady_clock::now();
+    BigRational bigTotal{ offset };
+    for (const BigRational& term : terms)
+        bigTotal += term;
+    std::chrono::duration<double, std::nano> bigTime{ std::chrono::steady_clock::now() - start };
+
+    std::cout << (total.isSmall() && bigTotal - offset == total) << '\n';
+    std::cout << "sum of " << n_sums << " small terms: inline " << smallTime.count() / n_sums << " ns, BigInt "
+              << bigTime.count() / n_sums << " ns per term\n";
+
+    return 0;
+}
@@ -0,0 +1,152 @@
+#include "FixedPoint.h"
+#include "FixedPointBatch.h"
+#include "../cppCommon/Random.h"
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+using Amount = FixedPoint<std::int32_t, 2>;
+using Price = FixedPoint<std::int64_t, 4>;
+using FixedPointBatch::Kernel;
+
+namespace
+{
+    constexpr Kernel kernels[]{ Kernel::scalar, Kernel::avx2 };
+
+    template <typename Value>
+    std::vector<Value> makeColumn(std::size_t count, typename Value::Raw limit, Random::Generator& gen)
+    {
+        std::vector<Value> column{};
+        for (std::size_t i{ 0 }; i < count; ++i)
+        {
+            auto magnitude{ static_cast<typename Value::Raw>(Random::getBounded(gen, static_cast<std::uint32_t>(limit))) };
+            column.push_back(Value::fromRaw(Random::get(gen, 0, 1) ? magnitude : -magnitude));
+        }
+        return column;
+    }
+
+    // Every kernel against one value at a time, with odd lengths for the tails
+    template <typename Value>
+    bool checkKernels(const std::vector<Value>& x, const std::vector<Value>& y)
+    {
+        using Wide = FixedPoint<std::int64_t, Value::decimal_digits>;
+        bool valid{ true };
+        for (std::size_t count : { std::size_t{ 0 }, std::size_t{ 3 }, std::size_t{ 13 }, x.size() })
+        {
+            Wide total{};
+            FixedPointBatch::Int128 products{ 0 };
+            for (std::size_t i{ 0 }; i < count; ++i)
+            {
+                total += Wide::fromRaw(x[i].getRaw());
+                products += static_cast<FixedPointBatch::Int128>(x[i].getRaw()) * y[i].getRaw();
+            }
+            Wide dot{ Wide::fromRaw(static_cast<std::int64_t>(Wide::divideRounded(products, Wide::scale, FixedPointRounding::halfEven))) };
+
+            for (Kernel kernel : kernels)
+            {
+                std::vector<Value> scaled(count);
+                std::vector<std::int8_t> signs(count);
+                FixedPointBatch::scale(x.data(), scaled.data(), count, typename Value::Raw{ -3 }, kernel);
+                FixedPointBatch::compare(x.data(), y.data(), signs.data(), count, kernel);
+
+                valid = valid && FixedPointBatch::sum(x.data(), count, kernel) == total
+                        && FixedPointBatch::dot(x.data(), y.data(), count, FixedPointRounding::halfEven, kernel) == dot;
+                for (std::size_t i{ 0 }; i < count; ++i)
+                {
+                    valid = valid && scaled[i] == x[i] * -3
+                            && signs[i] == (x[i] > y[i] ? 1 : (x[i] < y[i] ? -1 : 0));
+                }
+            }
+        }
+        return valid;
+    }
+
+    template <typename Function>
+    double timeNs(Function function, std::size_t count)
+    {
+        constexpr int n_rounds{ 20 };
+        auto start{ std::chrono::steady_clock::now() };
+        for (int round{ 0 }; round < n_rounds; ++round)
+            function();
+        std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start };
+        return elapsed.count() / (n_rounds * static_cast<double>(count));
+    }
+}
+
+int main()
+{
+    std::cout << std::boolalpha;
+    Random::Generator gen{ Random::getStream(22, 0) };
+
+    // Same arithmetic whatever the integer type and scale
+    static_assert(Price{ 1.2345 } * Price{ 2.0 } == Price{ 2.469 });
+    static_assert(Amount{ 10, 0 } / Amount{ 3, 0 } == Amount{ 3, 33 });
+    static_assert(FixedPoint<std::int16_t, 1>{ 1, 5 } + FixedPoint<std::int16_t, 1>{ 2, 7 } == FixedPoint<std::int16_t, 1>{ 4, 2 });
+    static_assert(Price::scale == 10000 && Amount::scale == 100);
+
+    constexpr std::size_t n_values{ 1 << 20 };
+    std::vector<Amount> amounts{ makeColumn<Amount>(n_values, 100000000, gen) };
+    std::vector<Amount> rates{ makeColumn<Amount>(n_values, 100000, gen) };
+    std::vector<Price> prices{ makeColumn<Price>(n_values, 4000000000u, gen) };
+    std::vector<Price> limits{ makeColumn<Price>(n_values, 4000000000u, gen) };
+    prices[7] = limits[7];
+    amounts[9] = rates[9];
+
+    std::cout << checkKernels(amounts, rates) << ' ' << checkKernels(prices, limits) << '\n';
+
+    // 64-bit lanes that wrap fall back to exact 128-bit sums
+    constexpr std::int64_t half_max{ INT64_MAX / 2 };
+    std::vector<Price> huge(19, Price::fromRaw(-half_max));
+    for (std::size_t i{ 0 }; i < 16; ++i)
+        huge[i] = Price::fromRaw(i % 4 == 0 ? half_max : 0);
+    std::cout << (FixedPointBatch::sum(huge.data(), huge.size(), Kernel::avx2) == Price::fromRaw(half_max)) << ' '
+              << (FixedPointBatch::sum(huge.data(), huge.size(), Kernel::scalar) == Price::fromRaw(half_max)) << '\n';
+
+    std::vector<Amount> large(16, Amount::fromRaw(2000000000));
+    std::cout << (FixedPointBatch::dotRaw(FixedPointBatch::getRaw(large.data()), FixedPointBatch::getRaw(large.data()),
+                                          large.size(), Kernel::avx2)
+                  == static_cast<FixedPointBatch::Int128>(16) * 2000000000 * 2000000000) << ' '
+              << !FixedPointBatch::scaleRaw(FixedPointBatch::getRaw(large.data()), FixedPointBatch::getRaw(large.data()),
+                                            large.size(), 2, Kernel::avx2) << '\n';
+
+    // Throughput against one object at a time
+    volatile std::int64_t sink{ 0 };
+    double perObject{ timeNs([&] {
+        FixedPoint<std::int64_t, 2> total{};
+        for (const Amount& amount : amounts)
+            total += FixedPoint<std::int64_t, 2>::fromRaw(amount.getRaw());
+        sink = total.getRaw();
+    }, n_values) };
+    double viaDouble{ timeNs([&] {
+        double total{ 0.0 };
+        for (const Amount& amount : amounts)
+            total += static_cast<double>(amount);
+        sink = static_cast<std::int64_t>(total);
+    }, n_values) };
+    std::cout << "sum: operator+= " << perObject << " ns, double " << viaDouble << " ns";
+    for (Kernel kernel : kernels)
+    {
+        std::cout << ", " << (kernel == Kernel::avx2 ? "AVX2 " : "scalar ")
+                  << timeNs([&] { sink = FixedPointBatch::sum(amounts.data(), n_values, kernel).getRaw(); }, n_values) << " ns";
+    }
+    std::cout << " per value\n";
+
+    std::vector<std::int8_t> signs(n_values);
+    for (Kernel kernel : kernels)
+    {
+        double dot{ timeNs([&] {
+            sink = FixedPointBatch::dot(amounts.data(), rates.data(), n_values, FixedPointRounding::halfEven, kernel).getRaw();
+        }, n_values) };
+        double scale{ timeNs([&] {
+            FixedPointBatch::scale(rates.data(), rates.data(), n_values, std::int32_t{ 1 }, kernel);
+        }, n_values) };
+        double compare{ timeNs([&] {
+            FixedPointBatch::compare(amounts.data(), rates.data(), signs.data(), n_values, kernel);
+        }, n_values) };
+        std::cout << (kernel == Kernel::avx2 ? "AVX2" : "scalar") << ": dot " << dot << " ns, scale " << scale
+                  << " ns, compare " << compare << " ns per value\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+#include "FixedPoint.h"
+#include "FixedPoint2.h"
+#include "FixedPointText.h"
+#include "../cppCommon/Random.h"
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    template <typename Value>
+    bool parsesAs(std::string_view text, Value expected, FixedPointRounding rounding = FixedPointRounding::halfAwayFromZero)
+    {
+        Value value{};
+        std::from_chars_result result{ FixedPointText::fromChars(text.data(), text.data() + text.size(), value, rounding) };
+        return result.ec == std::errc{} && result.ptr == text.data() + text.size() && value == expected;
+    }
+
+    template <typename Value>
+    std::string format(Value value)
+    {
+        char buffer[FixedPointText::max_chars<typename Value::Raw, Value::decimal_digits>];
+        std::to_chars_result result{ FixedPointText::toChars(buffer, buffer + sizeof(buffer), value) };
+        return std::string(buffer, result.ptr);
+    }
+
+    std::errc parseError(std::string_view text)
+    {
+        FixedPoint2 value{};
+        return FixedPointText::fromChars(text.data(), text.data() + text.size(), value).ec;
+    }
+}
+
+int main()
+{
+    std::cout << std::boolalpha;
+    using Rounding = FixedPointRounding;
+    using Small = FixedPoint<std::int16_t, 1>;
+
+    // Parsing: signs, missing parts, extra digits rounded away
+    std::cout << parsesAs("12", FixedPoint2{ 12, 0 }) << ' ' << parsesAs("-0.5", FixedPoint2{ 0, -50 }) << ' '
+              << parsesAs("+3.", FixedPoint2{ 3, 0 }) << ' ' << parsesAs(".25", FixedPoint2{ 0, 25 }) << ' '
+              << parsesAs("5.01", FixedPoint2{ 5, 1 }) << ' ' << parsesAs("007.10", FixedPoint2{ 7, 10 }) << '\n';
+    std::cout << parsesAs("1.005", FixedPoint2{ 1, 1 }) << ' '
+              << parsesAs("1.005", FixedPoint2{ 1, 0 }, Rounding::halfEven) << ' '
+              << parsesAs("1.0050001", FixedPoint2{ 1, 1 }, Rounding::halfEven) << ' '
+              << parsesAs("-1.001", FixedPoint2{ -1, 1 }, Rounding::down) << ' '
+              << parsesAs("-1.009", FixedPoint2{ -1, 0 }, Rounding::towardZero) << ' '
+              << parsesAs("1.0000001", FixedPoint2{ 1, 1 }, Rounding::up) << '\n';
+
+    // Whole range and nothing beyond it
+    std::cout << parsesAs("92233720368547758.07", FixedPoint2::fromRaw(INT64_MAX)) << ' '
+              << parsesAs("-92233720368547758.08", FixedPoint2::fromRaw(INT64_MIN)) << ' '
+              << (parseError("92233720368547758.08") == std::errc::result_out_of_range) << ' '
+              << (parseError("99999999999999999999999") == std::errc::result_out_of_range) << ' '
+              << parsesAs("-3276.8", Small::fromRaw(-32768)) << ' '
+              << (parseError("") == std::errc::invalid_argument && parseError("-.") == std::errc::invalid_argument
+                  && parseError("abc") == std::errc::invalid_argument) << '\n';
+
+    // Stops at the first character that is not part of the number
+    FixedPoint2 value{};
+    const char* text{ "12.5,7" };
+    std::from_chars_result partial{ FixedPointText::fromChars(text, text + std::strlen(text), value) };
+    std::cout << (partial.ptr == text + 4 && value == FixedPoint2{ 12, 50 }) << '\n';
+
+    // Formatting
+    char tiny[4]{};
+    std::cout << (format(FixedPoint2{ 0, -5 }) == "-0.05") << ' ' << (format(FixedPoint2{ 106.9978 }) == "107.00") << ' '
+              << (format(FixedPoint2::fromRaw(INT64_MIN)) == "-92233720368547758.08") << ' '
+              << (format(Small::fromRaw(-32768)) == "-3276.8") << ' ' << (format(FixedPoint<std::int32_t, 0>::fromRaw(-7)) == "-7")
+              << ' ' << (FixedPointText::toChars(tiny, tiny + 4, FixedPoint2{ 10, 0 }).ec == std::errc::value_too_large)
+              << '\n';
+
+    // Every value formats and parses back to itself
+    Random::Generator gen{ Random::getStream(23, 0) };
+    constexpr std::size_t n_values{ 1 << 20 };
+    std::vector<FixedPoint2> values{};
+    for (std::size_t i{ 0 }; i < n_values; ++i)
+    {
+        std::int64_t raw{ static_cast<std::int64_t>(gen()) >> Random::get(gen, 0, 60) };
+        values.push_back(FixedPoint2::fromRaw(raw));
+    }
+
+    bool roundTrip{ true };
+    std::string lines{};
+    for (FixedPoint2 original : values)
+    {
+        std::string formatted{ format(original) };
+        roundTrip = roundTrip && parsesAs(formatted, original);
+        lines += formatted;
+        lines += (original.getRaw() % 3 == 0) ? "\r\n\n" : "\n";
+    }
+    std::cout << roundTrip << '\n';
+
+    // Bulk parse: all in one go, then in small pieces carrying on from ptr
+    std::vector<FixedPoint2> parsed(n_values);
+    FixedPointText::BulkResult bulk{ FixedPointText::parseLines(lines.data(), lines.data() + lines.size(), parsed.data(),
+                                                                parsed.size()) };
+    bool pieces{ true };
+    const char* next{ lines.data() };
+    for (std::size_t done{ 0 }; done < n_values && pieces;)
+    {
+        FixedPoint2 chunk[1000]{};
+        FixedPointText::BulkResult part{ FixedPointText::parseLines(next, lines.data() + lines.size(), chunk, 1000) };
+        for (std::size_t i{ 0 }; i < part.count; ++i)
+            pieces = pieces && chunk[i] == values[done + i];
+        pieces = pieces && part.ec == std::errc{} && part.count > 0;
+        done += part.count;
+        next = part.ptr;
+    }
+    std::cout << (bulk.count == n_values && bulk.ec == std::errc{} && parsed == values) << ' ' << pieces << '\n';
+
+    std::string bad{ "1.00\n2.50\n3.x5\n4\n" };
+    FixedPointText::BulkResult stopped{ FixedPointText::parseLines(bad.data(), bad.data() + bad.size(), parsed.data(),
+                                                                   parsed.size()) };
+    std::cout << (stopped.count == 2 && stopped.ec == std::errc::invalid_argument && stopped.ptr == bad.data() + 10)
+              << '\n';
+
+    // Throughput against streams through double
+    auto start{ std::chrono::steady_clock::now() };
+    FixedPointText::parseLines(lines.data(), lines.data() + lines.size(), parsed.data(), parsed.size());
+    std::chrono::duration<double, std::nano> bulkTime{ std::chrono::steady_clock::now() - start };
+
+    std::istringstream in{ lines };
+    start = std::chrono::steady_clock::now();
+    for (double number{}; in >> number;)
+        parsed[0] = FixedPoint2{ number };
+    std::chrono::duration<double, std::nano> streamTime{ std::chrono::steady_clock::now() - start };
+
+    char buffer[FixedPointText::max_chars<std::int64_t, 2>];
+    std::size_t written{ 0 };
+    start = std::chrono::steady_clock::now();
+    for (FixedPoint2 original : values)
+        written += static_cast<std::size_t>(FixedPointText::toChars(buffer, buffer + sizeof(buffer), original).ptr - buffer);
+    std::chrono::duration<double, std::nano> formatTime{ std::chrono::steady_clock::now() - start };
+
+    std::ostringstream out{};
+    start = std::chrono::steady_clock::now();
+    for (FixedPoint2 original : values)
+        out << static_cast<double>(original) << '\n';
+    std::chrono::duration<double, std::nano> printTime{ std::chrono::steady_clock::now() - start };
+
+    std::cout << "parse " << bulkTime.count() / n_values << " ns (stream " << streamTime.count() / n_values
+              << " ns), format " << formatTime.count() / n_values << " ns (stream " << printTime.count() / n_values
+              << " ns) per value, " << written << " bytes\n";
+
+    return 0;
+}
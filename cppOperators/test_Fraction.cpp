@@ -0,0 +1,124 @@
+#include "Fraction.h"
+#include "../cppCommon/Random.h"
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+using Fraction64 = BasicFraction<std::int64_t>;
+
+int main()
+{
+    std::cout << std::boolalpha;
+    Random::Generator gen{ Random::getStream(24, 0) };
+
+    // Lowest terms only when asked, but equal whatever the terms
+    static_assert(Fraction{ 2, 4 } == Fraction{ 1, 2 } && Fraction{ 1, -2 } == Fraction{ -1, 2 });
+    static_assert(Fraction{ 1, 2 } + Fraction{ 1, 3 } == Fraction{ 5, 6 } && Fraction{ 1, 2 } - Fraction{ 3, 4 } == Fraction{ -1, 4 });
+    static_assert(Fraction{ 2, 3 } * 3 == 2 && 1 / Fraction{ 2, 3 } == Fraction{ 3, 2 });
+    static_assert(Fraction{ 3, 2 } > Fraction{ 5, 8 } && !(Fraction{ 1, 2 } > Fraction{ 2, 4 }) && Fraction{ 1, 2 } >= Fraction{ 2, 4 });
+    static_assert(Fraction{ 6, 8 }.getNumerator() == 3 && Fraction{ 6, 8 }.getDenominator() == 4);
+    static_assert(Fraction64::gcd(std::uint64_t{ 84 }, std::uint64_t{ 36 }) == 12 && Fraction64::gcd(std::uint64_t{ 7 }, std::uint64_t{ 7 }) == 7);
+
+    // Binary GCD against std::gcd
+    bool gcdMatches{ true };
+    for (int i{ 0 }; i < 100000; ++i)
+    {
+        std::uint64_t a{ gen() >> Random::get(gen, 0, 63) };
+        std::uint64_t b{ gen() >> Random::get(gen, 0, 63) };
+        using UInt128 = Fraction64::UInt128;
+        gcdMatches = gcdMatches && Fraction64::gcd(a, b) == std::gcd(a, b)
+                     && Fraction64::gcd(UInt128{ a } << 40, UInt128{ b } << 40) == UInt128{ std::gcd(a, b) } << 40;
+    }
+    std::cout << gcdMatches << '\n';
+
+    std::vector<std::uint64_t> pairs{};
+    for (int i{ 0 }; i < 200000; ++i)
+        pairs.push_back(gen() >> 1);
+    std::uint64_t check{ 0 };
+    auto start{ std::chrono::steady_clock::now() };
+    for (std::size_t i{ 0 }; i < pairs.size(); i += 2)
+        check += Fraction64::gcd(pairs[i], pairs[i + 1]);
+    std::chrono::duration<double, std::nano> binaryTime{ std::chrono::steady_clock::now() - start };
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i{ 0 }; i < pairs.size(); i += 2)
+        check -= std::gcd(pairs[i], pairs[i + 1]);
+    std::chrono::duration<double, std::nano> stdTime{ std::chrono::steady_clock::now() - start };
+    std::cout << (check == 0) << " (64-bit gcd: binary " << binaryTime.count() / 100000 << " ns, std::gcd "
+              << stdTime.count() / 100000 << " ns)\n";
+
+    // Random arithmetic against the same sums done by hand in 128 bits
+    bool exact{ true };
+    for (int i{ 0 }; i < 100000; ++i)
+    {
+        std::int64_t a{ Random::get(gen, -1000000, 1000000) };
+        std::int64_t b{ Random::get(gen, 1, 1000000) };
+        std::int64_t c{ Random::get(gen, -1000000, 1000000) };
+        std::int64_t d{ Random::get(gen, 1, 1000000) };
+        Fraction64 x{ a, b };
+        Fraction64 y{ c, d };
+
+        Fraction64 sum{ x + y };
+        Fraction64 product{ x * y };
+        exact = exact && sum * Fraction64{ b * d } == Fraction64{ a * d + c * b }
+                && product * Fraction64{ b * d } == Fraction64{ a * c } && (x - y) + y == x;
+        if (c != 0)
+            exact = exact && (x / y) * y == x;
+        exact = exact && ((x < y) == (static_cast<Fraction64::Int128>(a) * d < static_cast<Fraction64::Int128>(c) * b));
+    }
+    std::cout << exact << '\n';
+
+    // Products that overflow as they stand are reduced rather than wrapped
+    constexpr std::int64_t big{ INT64_MAX / 3 };
+    Fraction64 result{};
+    Fraction small{};
+    std::cout << (Fraction64{ big, 2 } * Fraction64{ 2, big } == 1) << ' '
+              << (Fraction{ 46341, 2 } * Fraction{ 2, 46341 } == 1) << ' '
+              << !Fraction64::tryMultiply(Fraction64{ big }, Fraction64{ 4 }, result) << ' '
+              << !Fraction::tryAdd(Fraction{ INT32_MAX }, Fraction{ 1 }, small) << ' '
+              << !Fraction64::tryDivide(Fraction64{ 1 }, Fraction64{ 0 }, result) << '\n';
+
+    // Comparison is exact right up to the limit
+    std::cout << (Fraction64{ INT64_MAX, INT64_MAX - 1 } < Fraction64{ INT64_MAX - 1, INT64_MAX - 2 }) << ' '
+              << (Fraction64{ -INT64_MAX, INT64_MAX - 1 } > Fraction64{ -(INT64_MAX - 1), INT64_MAX - 2 }) << '\n';
+
+    // Printed in lowest terms; read back
+    std::ostringstream out{};
+    out << Fraction64{ 10, -4 };
+    std::istringstream in{ "6/9" };
+    Fraction read{};
+    in >> read;
+    std::cout << (out.str() == "-5/2") << ' ' << (read == Fraction{ 2, 3 } && in) << '\n';
+
+    // Accumulating probabilities: lazy reduction against reducing every step
+    constexpr int n_terms{ 1000000 };
+    std::vector<Fraction64> terms{};
+    for (int i{ 0 }; i < n_terms; ++i)
+    {
+        int denominator{ Random::get(gen, 1, 12) };
+        terms.push_back(Fraction64{ Random::get(gen, 0, denominator), denominator });
+    }
+
+    start = std::chrono::steady_clock::now();
+    Fraction64 lazy{};
+    for (const Fraction64& term : terms)
+        lazy += term;
+    std::chrono::duration<double, std::nano> lazyTime{ std::chrono::steady_clock::now() - start };
+
+    start = std::chrono::steady_clock::now();
+    Fraction64 eager{};
+    for (const Fraction64& term : terms)
+    {
+        eager += term;
+        eager.reduce();
+    }
+    std::chrono::duration<double, std::nano> eagerTime{ std::chrono::steady_clock::now() - start };
+
+    std::cout << (lazy == eager && lazy.getDenominator() <= 27720) << '\n';
+    std::cout << "sum of " << n_terms << " terms: lazy " << lazyTime.count() / n_terms << " ns, reduce every step "
+              << eagerTime.count() / n_terms << " ns per term\n";
+
+    return 0;
+}